@@ -0,0 +1,23 @@
+#pragma once
+
+/// ============================================================================================================
+/// 并发容器的线程约定(Sequential_Queue_SPSC、Sequential_Queue_MPMC、Link_Queue_Concurrent、Link_Stack_Concurrent)
+/// - 各容器的头部注释列出可以在多个线程中同时调用的操作，其余操作(Queue_Show/Stack_Show、拷贝构造等)
+///   只能在没有其他线程访问时调用
+/// - Is_Empty/Get_Size在并发修改时只是某一时刻的近似值
+/// - Get_Front/Get_Top返回的引用在其他线程取走该元素后失效；并发时用Try_Dequeue/Try_Pop同时读取并取出
+/// - Try_*失败(队满/队空/栈空)时返回false，Element_*失败时与单线程容器一样抛出异常
+///
+/// 取出的元素
+/// - 顺序队列出队时直接析构槽位中的元素
+/// - 链式容器的节点要等回收域确认没有线程持有后才回收，Element_Dequeue/Element_Pop/Clear先用Discard_Element
+///   把节点中的元素重置为ElementType{}，立即释放它持有的资源，因此ElementType需要可以默认构造；
+///   Try_Dequeue/Try_Pop把元素移出，节点中只留下被移动后的对象
+/// ============================================================================================================
+
+namespace Storage
+{
+	/// 节点延迟回收时，先释放其中已取出的元素持有的资源
+	template <typename ElementType>
+	void Discard_Element(ElementType &element) { element = ElementType{}; }
+}
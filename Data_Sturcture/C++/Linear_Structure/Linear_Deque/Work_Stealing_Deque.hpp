@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm> //max
+#include <atomic>
+#include <bit> //bit_ceil
+#include <cstdint>
+#include <memory> //unique_ptr
+#include <type_traits>
+#include <vector>
+
+/// ============================================================================================================
+/// 工作窃取双端队列，Chase & Lev《Dynamic Circular Work-Stealing Deque》
+/// 内存序按Lê等《Correct and Efficient Work-Stealing for Weak Memory Models》的C11版本
+/// - 每个工作线程拥有一个双端队列：拥有者在底部(bottom)入队和出队(后进先出，局部性好)，
+///   其他线程(窃取者)从顶部(top)窃取(先进先出，取走的是最早拆分出的、通常最大的任务)
+/// - 元素为[top,bottom)区间，下标只增不减(bottom在出队时减一)，数组位置为 下标 & (容量-1)
+/// - 拥有者入队只写bottom；窃取者之间、以及拥有者取最后一个元素时与窃取者之间用CAS竞争top
+/// - 数组满时拥有者换成两倍容量的数组并拷贝[top,bottom)，窃取者可能还在读旧数组，
+///   旧数组保留到双端队列析构(各次的容量为等比数列，总和小于当前容量)
+///
+/// 元素
+/// - 窃取者读取元素与拥有者覆盖同一位置可能同时发生(之后窃取者的CAS会失败)，元素存放在std::atomic中，
+///   因此ElementType必须可平凡拷贝，通常为任务指针或表示子问题的下标区间
+///
+/// 线程约定
+/// - Element_Push/Try_Pop/Clear 只能在拥有者线程中调用；Try_Steal可以在任意多个线程中同时调用
+/// - Is_Empty/Get_Size在并发时是近似值
+/// ============================================================================================================
+
+template <typename ElementType>
+class Work_Stealing_Deque
+{
+	static_assert(std::is_trivially_copyable_v<ElementType>, "Work_Stealing_Deque: ElementType must be trivially copyable");
+	static constexpr size_t cache_line = 64;
+
+	/// 环形数组，容量为2的幂
+	struct Array
+	{
+		size_t mask;
+		std::unique_ptr<std::atomic<ElementType>[]> slots;
+
+		explicit Array(size_t capcity) : mask{capcity - 1}, slots{new std::atomic<ElementType>[capcity]} {}
+		size_t Get_Capcity() const { return mask + 1; }
+		ElementType Load(int64_t index) const { return slots[index & mask].load(std::memory_order_relaxed); }
+		void Store(int64_t index, const ElementType &element) { slots[index & mask].store(element, std::memory_order_relaxed); }
+	};
+
+private:
+	alignas(cache_line) std::atomic<int64_t> top{};	   // 下一次窃取的位置，窃取者之间竞争
+	alignas(cache_line) std::atomic<int64_t> bottom{};  // 下一次入队的位置，只有拥有者修改
+	alignas(cache_line) std::atomic<Array *> array{};	   // 当前数组，只有拥有者扩容时修改
+	std::vector<std::unique_ptr<Array>> arrays;			   // 当前及扩容前的所有数组，只有拥有者访问
+
+private:
+	/// 换成两倍容量的数组，拷贝[first,last)的元素。分配失败时抛出，双端队列不变
+	Array *_Grow(Array *old, int64_t first, int64_t last)
+	{
+		auto bigger = std::make_unique<Array>(old->Get_Capcity() * 2);
+		for (int64_t index = first; index < last; index++)
+			bigger->Store(index, old->Load(index));
+		arrays.push_back(std::move(bigger));
+		// release：窃取者读到新数组时，能看到拷贝的元素
+		array.store(arrays.back().get(), std::memory_order_release);
+		return arrays.back().get();
+	}
+
+public:
+	/// @param capcity 初始容量，向上取整为2的幂
+	explicit Work_Stealing_Deque(size_t capcity = 64)
+	{
+		arrays.push_back(std::make_unique<Array>(std::bit_ceil(std::max<size_t>(capcity, 2))));
+		array.store(arrays.back().get(), std::memory_order_relaxed);
+	}
+	Work_Stealing_Deque(const Work_Stealing_Deque &) = delete;
+	Work_Stealing_Deque &operator=(const Work_Stealing_Deque &) = delete;
+
+public:
+	bool Is_Empty() const { return Get_Size() == 0; }
+	size_t Get_Size() const
+	{
+		int64_t last = bottom.load(std::memory_order_relaxed);
+		int64_t first = top.load(std::memory_order_relaxed);
+		return static_cast<size_t>(std::max<int64_t>(last - first, 0));
+	}
+	size_t Get_Capcity() const { return array.load(std::memory_order_acquire)->Get_Capcity(); }
+	// 清空双端队列：拥有者逐个出队，可以与窃取并发
+	void Clear()
+	{
+		ElementType element;
+		while (Try_Pop(element))
+			;
+	}
+
+public:
+	/// @brief 拥有者在底部入队，数组满时扩容
+	void Element_Push(const ElementType &element)
+	{
+		int64_t last = bottom.load(std::memory_order_relaxed);
+		int64_t first = top.load(std::memory_order_acquire);
+		Array *current = array.load(std::memory_order_relaxed);
+		if (last - first > static_cast<int64_t>(current->mask))
+			current = _Grow(current, first, last);
+		current->Store(last, element);
+		// release：窃取者读到新的bottom时，能看到写入的元素
+		bottom.store(last + 1, std::memory_order_release);
+	}
+	/// @brief 拥有者从底部出队，双端队列为空(或最后一个元素被窃取)时返回false
+	bool Try_Pop(ElementType &element)
+	{
+		int64_t last = bottom.load(std::memory_order_relaxed) - 1;
+		Array *current = array.load(std::memory_order_relaxed);
+		bottom.store(last, std::memory_order_relaxed);
+		// 先占住底部再读top：与窃取中的栅栏配对，拥有者和窃取者至少有一方看到对方的修改
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t first = top.load(std::memory_order_relaxed);
+		if (first > last)
+		{ // 已经为空，恢复bottom
+			bottom.store(last + 1, std::memory_order_relaxed);
+			return false;
+		}
+		if (first < last)
+		{ // 不止一个元素，窃取者不会取到last
+			element = current->Load(last);
+			return true;
+		}
+		// 只剩最后一个元素，与窃取者竞争top
+		ElementType popped = current->Load(last);
+		bool won = top.compare_exchange_strong(first, first + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		bottom.store(last + 1, std::memory_order_relaxed);
+		if (won)
+			element = popped;
+		return won;
+	}
+	/// @brief 从顶部窃取一个元素，可以在任意线程中调用
+	/// @return 双端队列为空，或与其他线程竞争同一元素失败时返回false(失败时可以重试或换一个双端队列)
+	bool Try_Steal(ElementType &element)
+	{
+		int64_t first = top.load(std::memory_order_acquire);
+		// 先读top再读bottom，与拥有者出队中的栅栏配对
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t last = bottom.load(std::memory_order_acquire);
+		if (first >= last)
+			return false;
+		// 位置first可能同时被拥有者覆盖(扩容后或出队后再入队)，此时top已经改变，下面的CAS失败，丢弃读到的值
+		ElementType stolen = array.load(std::memory_order_acquire)->Load(first);
+		if (!top.compare_exchange_strong(first, first + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return false;
+		element = stolen;
+		return true;
+	}
+};
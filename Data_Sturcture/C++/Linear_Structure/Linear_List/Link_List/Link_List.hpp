@@ -1,10 +1,15 @@
 #pragma once
 
 #include <mutex> //call_once
-#include <bitset>
 #include <set>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <functional> //less
+#include <utility>	 //exchange
 
 #include "../../List_Node.hpp"
+#include "../../List_Node_Allocator.hpp"
 #include "../Linear_List.hpp"
 
 
@@ -15,89 +20,507 @@ namespace Storage
 {
 
 	// 链式存储结构模板
-	template <typename NodeType, typename ElementType>
+	/// @tparam AllocatorPolicy 节点分配策略，见List_Node_Allocator.hpp
+	template <typename NodeType, typename ElementType, typename AllocatorPolicy = Policy::Node_New>
 	class Link_List : public Logic::Linear_List<ElementType>
 	{
 	protected:
-		NodeType *front{}; // 直接指向首元节点，没有头结点
+		using Node_Allocator = typename AllocatorPolicy::template Allocator<NodeType>;
 
-	public:
-		Link_List() = default;
-		Link_List(size_t size) : Logic::Linear_List<ElementType>(size){};
-		Link_List(const Storage::Link_List<NodeType, ElementType> &other)
-			: Logic::Linear_List<ElementType>(other.size)
+		NodeType *front{};		  // 直接指向首元节点，没有头结点
+		NodeType *rear{};		  // 指向尾节点，用于尾插和双向迭代器从end()后退
+		Node_Allocator allocator{}; // 节点分配器，链表的所有节点都由它分配和回收
+
+		/// 游标：缓存最近一次定位的位序和节点，顺序或就近访问时从游标出发而不是从front出发
+		/// cursor_node为nullptr表示游标无效
+		size_t cursor_pos{};
+		NodeType *cursor_node{};
+
+	protected:
+		/// @brief 在尾节点tail之后追加一个新节点，tail为nullptr时作为首元节点
+		/// @return 新的尾节点
+		template <typename... Args>
+		NodeType *_Node_Append(NodeType *tail, Args &&...args)
 		{
-			if(this==&other)
-				throw std::logic_error("Self Copied");
-			NodeType *node = other.front, *self = front;
-			for (size_t i = 0; i < other.size; i++)
+			NodeType *node = allocator.Allocate(std::forward<Args>(args)...);
+			if constexpr (requires { node->pre; })
+				node->pre = tail;
+			(tail ? tail->next : front) = node;
+			rear = node;
+			return node;
+		}
+		// 回收所有节点
+		void _Nodes_Release()
+		{
+			allocator.Release(front);
+			front = rear = nullptr;
+			this->size = 0;
+			_Cursor_Reset();
+		}
+
+	protected: /// 游标维护
+		void _Cursor_Reset()
+		{
+			cursor_pos = 0;
+			cursor_node = nullptr;
+		}
+		void _Cursor_Set(size_t pos, NodeType *node)
+		{
+			cursor_pos = pos;
+			cursor_node = node;
+		}
+		// 在pos插入节点后调用：游标节点不变，位于pos及之后时位序后移
+		void _Cursor_Insert(size_t pos)
+		{
+			if (cursor_node && pos <= cursor_pos)
+				++cursor_pos;
+		}
+		// 删除pos处节点后调用：删除的是游标节点则失效，位于pos之后时位序前移
+		void _Cursor_Erase(size_t pos)
+		{
+			if (!cursor_node || pos > cursor_pos)
+				return;
+			if (pos == cursor_pos)
+				_Cursor_Reset();
+			else
+				--cursor_pos;
+		}
+		/// @brief 定位第pos个节点(调用前已检查pos合法)，并将游标移到该节点
+		/// @note 从front和游标中选择步数最少的起点：单链节点只能从游标向后走，双链节点还可以从游标向前走
+		NodeType *_Cursor_Locate(size_t pos)
+		{
+			NodeType *node = front;
+			size_t from = 1;
+			if (cursor_node)
 			{
-				if (!node)
-					throw std::logic_error("Copy Node Failed:size dose not match storage");
-				if (!self)
+				if (cursor_pos <= pos)
 				{
-					front = new NodeType(node->element, nullptr);
-					self = front; // node=nullptr时需要重新赋值，不然无效
-					continue;
+					node = cursor_node;
+					from = cursor_pos;
+				}
+				else if constexpr (requires { cursor_node->pre; })
+				{
+					if (cursor_pos - pos < pos - 1)
+					{
+						node = cursor_node;
+						for (; cursor_pos > pos; --cursor_pos)
+							node = node->pre;
+						cursor_node = node;
+						return node;
+					}
 				}
-				self->next = new NodeType(node->element, nullptr);
-				self = self->next;
-				node = node->next;
 			}
+			for (; from < pos; ++from)
+				node = node->next;
+			_Cursor_Set(pos, node);
+			return node;
 		}
-		Link_List(Storage::Link_List<NodeType, ElementType> &&other)
+
+	public:
+		Link_List() = default;
+		Link_List(size_t size) : Logic::Linear_List<ElementType>(size){};
+		Link_List(const Storage::Link_List<NodeType, ElementType, AllocatorPolicy> &other)
 			: Logic::Linear_List<ElementType>(other.size)
 		{
-			front = other.front;
-			other.front = nullptr;
+			if (this == &other)
+				throw std::logic_error("Self Copied");
+			NodeType *tail{};
+			for (NodeType *node = other.front; node; node = node->next)
+				tail = _Node_Append(tail, node->element);
+		}
+		Link_List(Storage::Link_List<NodeType, ElementType, AllocatorPolicy> &&other)
+			: Logic::Linear_List<ElementType>(other.size), front{other.front}, rear{other.rear}, allocator{std::move(other.allocator)}
+		{
+			other.front = other.rear = nullptr;
 			other.size = 0;
+			other._Cursor_Reset();
 		}
-		Link_List<NodeType, ElementType> &operator=(const Storage::Link_List<NodeType, ElementType> &other)
+		Link_List<NodeType, ElementType, AllocatorPolicy> &operator=(const Storage::Link_List<NodeType, ElementType, AllocatorPolicy> &other)
 		{
 			if (this == &other)
 				throw std::logic_error("Self assignment");
-			NodeType *node = other.front, *self = front;
-			for (size_t i = 0; i < other.size; i++)
-			{
-				if (!node)
-					throw std::logic_error("Copy Node Failed:size dose not match storage");
-				if (!self)
-				{
-					front = new NodeType(node->element, nullptr);
-					self = front; // node=nullptr时需要重新赋值，不然无效
-					continue;
-				}
-				self->next = new NodeType(node->element, nullptr);
-				self = self->next;
-				node = node->next;
-			}
+			_Nodes_Release();
+			NodeType *tail{};
+			for (NodeType *node = other.front; node; node = node->next)
+				tail = _Node_Append(tail, node->element);
+			this->size = other.size;
 			return *this;
 		}
-		Link_List<NodeType, ElementType> &operator=(Storage::Link_List<NodeType, ElementType> &&other)
+		Link_List<NodeType, ElementType, AllocatorPolicy> &operator=(Storage::Link_List<NodeType, ElementType, AllocatorPolicy> &&other)
 		{
+			if (this == &other)
+				throw std::logic_error("Self assignment");
+			_Nodes_Release();
 			front = other.front;
-			other.front = nullptr;
+			rear = other.rear;
+			allocator = std::move(other.allocator);
+			this->size = other.size;
+			other.front = other.rear = nullptr;
 			other.size = 0;
+			other._Cursor_Reset();
 			return *this;
 		}
 		Link_List(std::initializer_list<ElementType> list)
 			: Logic::Linear_List<ElementType>(list.size())
 		{
-			NodeType *node = front;
+			NodeType *tail{};
 			for (const auto &element : list)
+				tail = _Node_Append(tail, element);
+		}
+
+		virtual ~Link_List() { _Nodes_Release(); }
+
+	public: /// 迭代器
+		/// @brief 沿next遍历节点的迭代器，双链节点可以沿pre后退，end()后退到尾节点
+		/// @tparam is_const 为true时是const_iterator
+		template <bool is_const>
+		class Iterator
+		{
+			friend class Link_List;
+			using Node_Pointer = std::conditional_t<is_const, const NodeType *, NodeType *>;
+			using List_Pointer = std::conditional_t<is_const, const Link_List *, Link_List *>;
+
+			Node_Pointer node{};
+			List_Pointer list{};
+
+		public:
+			static constexpr bool bidirectional = requires(NodeType *node) { node->pre; };
+
+			using iterator_category = std::conditional_t<bidirectional, std::bidirectional_iterator_tag, std::forward_iterator_tag>;
+			using value_type = ElementType;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<is_const, const ElementType *, ElementType *>;
+			using reference = std::conditional_t<is_const, const ElementType &, ElementType &>;
+
+			Iterator() = default;
+			Iterator(Node_Pointer node, List_Pointer list) : node{node}, list{list} {}
+			// iterator可以隐式转换为const_iterator
+			template <bool other_const>
+				requires(is_const && !other_const)
+			Iterator(const Iterator<other_const> &other) : node{other.node}, list{other.list} {}
+
+			reference operator*() const { return node->element; }
+			pointer operator->() const { return &node->element; }
+			Iterator &operator++()
 			{
-				if (!node)
-				{
-					front = new NodeType(std::move(element), nullptr);
-					node = front; // node=nullptr时需要重新赋值，不然无效
-					continue;
-				}
-				node->next = new NodeType(std::move(element), nullptr);
 				node = node->next;
+				return *this;
 			}
+			Iterator operator++(int)
+			{
+				Iterator temp = *this;
+				++*this;
+				return temp;
+			}
+			Iterator &operator--()
+				requires bidirectional
+			{
+				node = node ? node->pre : list->rear;
+				return *this;
+			}
+			Iterator operator--(int)
+				requires bidirectional
+			{
+				Iterator temp = *this;
+				--*this;
+				return temp;
+			}
+			bool operator==(const Iterator &other) const { return node == other.node; }
+
+			template <bool>
+			friend class Iterator;
+		};
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+
+		iterator begin() { return {front, this}; }
+		iterator end() { return {nullptr, this}; }
+		const_iterator begin() const { return {front, this}; }
+		const_iterator end() const { return {nullptr, this}; }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+
+	private:
+		/// 迭代器操作不知道节点的位序，统一使游标失效
+		template <typename Value>
+		iterator _Insert_After(const_iterator position, Value &&element)
+		{
+			if (!position.node)
+				throw std::out_of_range("Insert Failed: position is end()");
+			NodeType *pre = const_cast<NodeType *>(position.node);
+			NodeType *node = allocator.Allocate(std::forward<Value>(element));
+			node->next = pre->next;
+			if constexpr (iterator::bidirectional)
+			{
+				node->pre = pre;
+				if (node->next)
+					node->next->pre = node;
+			}
+			pre->next = node;
+			if (pre == rear)
+				rear = node;
+			++this->size;
+			_Cursor_Reset();
+			return {node, this};
+		}
+
+	public:
+		/// @brief 在position之后插入元素，position不能是end()
+		/// @return 指向新元素的迭代器
+		iterator insert_after(const_iterator position, const ElementType &element) { return _Insert_After(position, element); }
+		iterator insert_after(const_iterator position, ElementType &&element) { return _Insert_After(position, std::move(element)); }
+
+		/// @brief 删除position之后的元素，O(1)
+		/// @return 指向被删除元素之后元素的迭代器
+		iterator erase_after(const_iterator position)
+		{
+			if (!position.node || !position.node->next)
+				throw std::out_of_range("Erase Failed: no element after position");
+			NodeType *pre = const_cast<NodeType *>(position.node), *del = pre->next;
+			pre->next = del->next;
+			if constexpr (iterator::bidirectional)
+				if (del->next)
+					del->next->pre = pre;
+			if (del == rear)
+				rear = pre;
+			allocator.Deallocate(del);
+			--this->size;
+			_Cursor_Reset();
+			return {pre->next, this};
+		}
+		/// @brief 删除position处的元素。双链表O(1)，单链表需要从front查找前驱，O(n)
+		/// @return 指向被删除元素之后元素的迭代器
+		iterator erase(const_iterator position)
+		{
+			if (!position.node)
+				throw std::out_of_range("Erase Failed: position is end()");
+			NodeType *del = const_cast<NodeType *>(position.node), *pre{};
+			if constexpr (iterator::bidirectional)
+				pre = del->pre;
+			else if (del != front)
+				for (pre = front; pre->next != del; pre = pre->next)
+					;
+			if (pre)
+				return erase_after({pre, this});
+
+			front = del->next;
+			if constexpr (iterator::bidirectional)
+				if (front)
+					front->pre = nullptr;
+			if (del == rear)
+				rear = nullptr;
+			allocator.Deallocate(del);
+			--this->size;
+			_Cursor_Reset();
+			return {front, this};
+		}
+
+	private: /// 排序与拼接的节点操作，只修改next，pre和rear最后由_Links_Rebuild统一修正
+		/// @brief 归并两条以nullptr结尾的有序链，相等时left在前(稳定)
+		/// @return 归并后的首节点
+		template <typename Compare>
+		static NodeType *_Chain_Merge(NodeType *left, NodeType *right, Compare &compare)
+		{
+			NodeType *head{}, **link = &head;
+			while (left && right)
+			{
+				NodeType *&from = compare(right->element, left->element) ? right : left;
+				*link = from;
+				link = &from->next;
+				from = from->next;
+			}
+			*link = left ? left : right;
+			return head;
+		}
+		// 沿next重建pre和rear
+		void _Links_Rebuild()
+		{
+			NodeType *pre{};
+			for (NodeType *node = front; node; node = node->next)
+			{
+				if constexpr (iterator::bidirectional)
+					node->pre = pre;
+				pre = node;
+			}
+			rear = pre;
+		}
+		/// @brief 把链[head,tail](count个节点)链接到节点pre之后，pre为nullptr时链接到表头，O(1)
+		void _Chain_Link(NodeType *pre, NodeType *head, NodeType *tail, size_t count)
+		{
+			tail->next = pre ? pre->next : front;
+			(pre ? pre->next : front) = head;
+			if constexpr (iterator::bidirectional)
+			{
+				head->pre = pre;
+				if (tail->next)
+					tail->next->pre = tail;
+			}
+			if (!tail->next)
+				rear = tail;
+			this->size += count;
+		}
+		/// @brief 从本表断开before之后到tail为止的链(count个节点)，before为nullptr时从首元节点开始，O(1)
+		/// @return 断开的链的首节点
+		NodeType *_Chain_Unlink(NodeType *before, NodeType *tail, size_t count)
+		{
+			NodeType *head = before ? before->next : front;
+			NodeType *after = tail->next;
+			(before ? before->next : front) = after;
+			if constexpr (iterator::bidirectional)
+				if (after)
+					after->pre = before;
+			if (!after)
+				rear = before;
+			this->size -= count;
+			_Cursor_Reset();
+			return head;
+		}
+		/// @brief 把链[head,tail](count个节点)链接为第pos个起的元素
+		/// @note 在表头或表尾拼接是O(1)，否则从游标定位第pos-1个节点
+		void _Chain_Insert(size_t pos, NodeType *head, NodeType *tail, size_t count)
+		{
+			_Chain_Link(pos == 1 ? nullptr : pos == this->size + 1 ? rear : _Cursor_Locate(pos - 1), head, tail, count);
+			_Cursor_Set(pos + count - 1, tail);
+		}
+		// 迭代器拼接的参数检查：position属于本表，range中的迭代器都属于other
+		void _Splice_Check(const_iterator position, const Link_List &other, std::initializer_list<const_iterator> range = {}) const
+		{
+			if (this == &other)
+				throw std::logic_error("Splice Failed: Self Spliced");
+			if (position.list != this)
+				throw std::invalid_argument("Splice Failed: position does not belong to the list");
+			for (const_iterator iterator : range)
+				if (iterator.list != &other)
+					throw std::invalid_argument("Splice Failed: range does not belong to other");
 		}
 
-		virtual ~Link_List() = default;
+	public: /// 排序与拼接：只修改节点的链接，不移动元素，不分配节点
+		/// @brief 自底向上的归并排序，稳定，O(nlogn)，额外空间O(1)
+		/// @param compare 严格弱序，compare(a,b)为true时a排在b之前
+		/// @note 按二进制计数归并：runs[i]为空或是长为2^i的有序链，每取下一个节点就像计数器加1一样向高位进位归并。
+		/// 	相比逐趟扫描整表，归并总是发生在刚处理过的节点上，缓存命中率高得多
+		template <typename Compare = std::less<>>
+		void Sort(Compare compare = {})
+		{
+			NodeType *runs[64]{}; // runs[i]中的元素都在runs[i-1]之前
+			for (NodeType *remain = front; remain;)
+			{
+				NodeType *carry = std::exchange(remain, remain->next);
+				carry->next = nullptr;
+				size_t i = 0;
+				for (; runs[i]; ++i)
+					carry = _Chain_Merge(std::exchange(runs[i], nullptr), carry, compare);
+				runs[i] = carry;
+			}
+			front = nullptr;
+			for (NodeType *run : runs)
+				if (run)
+					front = _Chain_Merge(run, front, compare);
+			_Links_Rebuild();
+			_Cursor_Reset();
+		}
+
+		/// @brief 把other的所有元素移动到本表，成为第pos个起的元素，other变为空表
+		/// @note 节点直接转移，在表头或表尾拼接是O(1)。要求分配策略的节点可以转移(Policy::Node_New)
+		void Splice(size_t pos, Link_List &other)
+			requires AllocatorPolicy::node_transferable
+		{
+			if (this == &other)
+				throw std::logic_error("Splice Failed: Self Spliced");
+			if (pos < 1 || pos > this->size + 1)
+				throw std::out_of_range("Splice Failed: Illegal position");
+			if (other.Is_Empty())
+				return;
+			NodeType *head = other.front, *tail = other.rear;
+			size_t count = other.size;
+			other.front = other.rear = nullptr;
+			other.size = 0;
+			other._Cursor_Reset();
+			_Chain_Insert(pos, head, tail, count);
+		}
+		/// @brief 把other的第first到第last个元素移动到本表，成为第pos个起的元素
+		/// @note 节点的断开和链接是O(1)，定位first和last从other的游标出发
+		void Splice(size_t pos, Link_List &other, size_t first, size_t last)
+			requires AllocatorPolicy::node_transferable
+		{
+			if (this == &other)
+				throw std::logic_error("Splice Failed: Self Spliced");
+			if (pos < 1 || pos > this->size + 1)
+				throw std::out_of_range("Splice Failed: Illegal position");
+			if (first < 1 || first > last || last > other.size)
+				throw std::out_of_range("Splice Failed: Illegal range");
+			NodeType *before = first == 1 ? nullptr : other._Cursor_Locate(first - 1);
+			NodeType *tail = last == other.size ? other.rear : other._Cursor_Locate(last);
+			size_t count = last - first + 1;
+			NodeType *head = other._Chain_Unlink(before, tail, count);
+			_Chain_Insert(pos, head, tail, count);
+		}
+
+		/// 迭代器版本的拼接：直接使用迭代器所指的节点，不按位序定位。与std::list/std::forward_list的splice语义相同
+		/// @brief 把other的所有元素移动到position之前，other变为空表，O(1)
+		void Splice(const_iterator position, Link_List &other)
+			requires AllocatorPolicy::node_transferable && iterator::bidirectional
+		{
+			_Splice_Check(position, other);
+			if (other.Is_Empty())
+				return;
+			NodeType *tail = other.rear;
+			size_t count = other.size;
+			NodeType *head = other._Chain_Unlink(nullptr, tail, count);
+			_Chain_Link(position.node ? position.node->pre : rear, head, tail, count);
+			_Cursor_Reset();
+		}
+		/// @brief 把other中[first,last)的元素移动到position之前
+		/// @note 断开和链接节点是O(1)；只为维护两表的长度沿[first,last)计数一次，O(last-first)
+		void Splice(const_iterator position, Link_List &other, const_iterator first, const_iterator last)
+			requires AllocatorPolicy::node_transferable && iterator::bidirectional
+		{
+			_Splice_Check(position, other, {first, last});
+			if (first == last)
+				return;
+			NodeType *head = const_cast<NodeType *>(first.node);
+			NodeType *tail = last.node ? last.node->pre : other.rear;
+			size_t count{1};
+			for (NodeType *node = head; node != tail; node = node->next)
+				++count;
+			other._Chain_Unlink(head->pre, tail, count);
+			_Chain_Link(position.node ? position.node->pre : rear, head, tail, count);
+			_Cursor_Reset();
+		}
+		/// @brief 把other中(before_first,last)的元素移动到position之后，单链表也不需要查找前驱
+		/// @note position和before_first不能是end()。断开和链接节点是O(1)，沿区间计数一次，O(last-before_first)
+		void Splice_After(const_iterator position, Link_List &other, const_iterator before_first, const_iterator last)
+			requires AllocatorPolicy::node_transferable
+		{
+			_Splice_Check(position, other, {before_first, last});
+			if (!position.node || !before_first.node)
+				throw std::out_of_range("Splice Failed: position is end()");
+			NodeType *before = const_cast<NodeType *>(before_first.node);
+			if (before->next == last.node)
+				return;
+			NodeType *tail = before->next;
+			size_t count{1};
+			for (; tail->next != last.node; tail = tail->next)
+				++count;
+			NodeType *head = other._Chain_Unlink(before, tail, count);
+			_Chain_Link(const_cast<NodeType *>(position.node), head, tail, count);
+			_Cursor_Reset();
+		}
+		/// @brief 把有序的other归并到有序的本表，other变为空表，稳定(相等时本表的元素在前)，O(n+m)
+		template <typename Compare = std::less<>>
+		void Merge(Link_List &other, Compare compare = {})
+			requires AllocatorPolicy::node_transferable
+		{
+			if (this == &other)
+				throw std::logic_error("Merge Failed: Self Merged");
+			front = _Chain_Merge(front, other.front, compare);
+			this->size += other.size;
+			other.front = other.rear = nullptr;
+			other.size = 0;
+			other._Cursor_Reset();
+			_Links_Rebuild();
+			_Cursor_Reset();
+		}
 
 	private:
 		virtual NodeType *_Element_Locate(size_t pos) = 0;
@@ -132,36 +555,36 @@ namespace Storage
 	class Link_List_Static : public Logic::Linear_List<ElementType>
 	{
 	public:
-		const size_t npos = maxsize;//无效index，类似nullptr,std::string::npos
+		static constexpr size_t npos = maxsize; // 无效index，类似nullptr,std::string::npos
 	protected:
 		// using Record = NodeType;
 		size_t front{npos}; // 首元素的下标,初始化为index_end+1,表示npos
+		size_t rear{npos};	// 尾元素的下标
 		NodeType storage[maxsize]{};
-		// 空闲列表，记录当前可用的数据
+		/// @brief 空闲列表，分配和归还都是O(1)
+		/// @note 归还的下标组成侵入式的栈：空闲节点的next存放下一个空闲下标，不需要额外空间
+		/// 	从未分配过的下标[used,maxsize)不入栈，按顺序取用，因此初始化也是O(1)
 		struct Free_List
 		{
 		private:
-			std::bitset<maxsize> free_list{}; // 0表示空闲，1表示已分配
-			size_t index{};
-			void Increase() { index = (++index) % maxsize; }
-			// void Decrease() { index = (--index) % maxsize; }
+			size_t head{npos}; // 栈顶的空闲下标，npos表示栈空
+			size_t used{};	   // 已经取用过的下标个数
+
 		public:
 			// 获取一个空闲的位置
-			size_t Allocate()
-			{ // 循环遍历查找空闲的位置
-				if (free_list.all())
+			size_t Allocate(NodeType (&storage)[maxsize])
+			{
+				if (head != npos)
+					return std::exchange(head, storage[head].next);
+				if (used == maxsize)
 					throw std::runtime_error("No Free Space");
-				while (free_list[index])
-					Increase();
-				free_list.set(index);
-				return index;
+				return used++;
 			}
-			// 归还一个位置
-			void Deallocate(size_t pos)
+			// 归还一个位置(调用前节点已从链中断开)
+			void Deallocate(NodeType (&storage)[maxsize], size_t index)
 			{
-				if (!free_list[pos])
-					std::logic_error("Insert Failed:Already Free before Insert");
-				free_list.reset(pos);
+				storage[index].next = head;
+				head = index;
 			}
 		};
 		Free_List free_list{};
@@ -169,21 +592,18 @@ namespace Storage
 	public:
 		Link_List_Static() = default;
 		Link_List_Static(size_t size) : Logic::Linear_List<ElementType>(size){};
-		Link_List_Static(const Storage::Link_List_Static<NodeType, ElementType,maxsize> &other)
-			: Logic::Linear_List<ElementType>(other.size)
+		Link_List_Static(const Storage::Link_List_Static<NodeType, ElementType, maxsize> &other)
+			: Logic::Linear_List<ElementType>(other.size), front{other.front}, rear{other.rear}, free_list{other.free_list}
 		{
 			for (size_t i = 0; i < maxsize; i++)
 				storage[i] = other.storage[i];
 		}
 		Link_List_Static(Storage::Link_List_Static<NodeType, ElementType, maxsize> &&other)
-			: Logic::Linear_List<ElementType>(other.size)
+			: Logic::Linear_List<ElementType>(other.size), front{other.front}, rear{other.rear}, free_list{other.free_list}
 		{
 			for (size_t i = 0; i < maxsize; i++)
-			{
 				storage[i] = std::move(other.storage[i]);
-				other.storage[i] = NodeType{};
-			}
-			other.size = 0;
+			other.List_Clear();
 		}
 
 		Link_List_Static<NodeType, ElementType, maxsize> &
@@ -193,7 +613,10 @@ namespace Storage
 				throw std::logic_error("Self Copied");
 
 			this->size = other.size;
-			for (size_t i = 0; i < this->size; i++)
+			front = other.front;
+			rear = other.rear;
+			free_list = other.free_list;
+			for (size_t i = 0; i < maxsize; i++)
 				storage[i] = other.storage[i];
 			return *this;
 		}
@@ -201,27 +624,112 @@ namespace Storage
 		Link_List_Static<NodeType, ElementType, maxsize> &
 		operator=(Storage::Link_List_Static<NodeType, ElementType, maxsize> &&other)
 		{
+			if (this == &other)
+				throw std::logic_error("Self Copied");
+
 			this->size = other.size;
-			for (size_t i = 0; i < this->size; i++)
-			{
+			front = other.front;
+			rear = other.rear;
+			free_list = other.free_list;
+			for (size_t i = 0; i < maxsize; i++)
 				storage[i] = std::move(other.storage[i]);
-				other.storage[i] = NodeType{};
-			}
-			other.size = 0;
+			other.List_Clear();
 			return *this;
 		}
-		
+
 		Link_List_Static(std::initializer_list<ElementType> list)
-			: Logic::Linear_List<ElementType>(list.size())
 		{
 			if (list.size() > maxsize)
 				throw std::runtime_error("initializer_list Constructed Failed: no enough capcity");
-			this->size = list.size();
-			size_t i{};
 			for (const auto &element : list)
-				storage[i++] = std::move(element);
+				_Link(free_list.Allocate(storage), rear, element);
 		}
 
+	public: /// 迭代器
+		/// @brief 沿下标next/pre遍历的双向迭代器，end()的下标为npos
+		template <bool is_const>
+		class Iterator
+		{
+			friend class Link_List_Static;
+			using List_Pointer = std::conditional_t<is_const, const Link_List_Static *, Link_List_Static *>;
+
+			List_Pointer list{};
+			size_t index{npos};
+
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type = ElementType;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<is_const, const ElementType *, ElementType *>;
+			using reference = std::conditional_t<is_const, const ElementType &, ElementType &>;
+
+			Iterator() = default;
+			Iterator(List_Pointer list, size_t index) : list{list}, index{index} {}
+			// iterator可以隐式转换为const_iterator
+			template <bool other_const>
+				requires(is_const && !other_const)
+			Iterator(const Iterator<other_const> &other) : list{other.list}, index{other.index} {}
+
+			reference operator*() const { return list->storage[index].element; }
+			pointer operator->() const { return &list->storage[index].element; }
+			Iterator &operator++()
+			{
+				index = list->storage[index].next;
+				return *this;
+			}
+			Iterator operator++(int)
+			{
+				Iterator temp = *this;
+				++*this;
+				return temp;
+			}
+			Iterator &operator--()
+			{
+				index = index == npos ? list->rear : list->storage[index].pre;
+				return *this;
+			}
+			Iterator operator--(int)
+			{
+				Iterator temp = *this;
+				--*this;
+				return temp;
+			}
+			bool operator==(const Iterator &other) const { return index == other.index; }
+
+			template <bool>
+			friend class Iterator;
+		};
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+
+		iterator begin() { return {this, front}; }
+		iterator end() { return {this, npos}; }
+		const_iterator begin() const { return {this, front}; }
+		const_iterator end() const { return {this, npos}; }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+
+		/// @brief 在position之后插入元素，position不能是end()
+		/// @return 指向新元素的迭代器
+		iterator insert_after(const_iterator position, const ElementType &element) { return _Insert_After(position, element); }
+		iterator insert_after(const_iterator position, ElementType &&element) { return _Insert_After(position, std::move(element)); }
+		/// @brief 删除position处的元素，O(1)
+		/// @return 指向被删除元素之后元素的迭代器
+		iterator erase(const_iterator position)
+		{
+			if (position.index == npos)
+				throw std::out_of_range("Erase Failed: position is end()");
+			size_t next = storage[position.index].next;
+			_Unlink(position.index);
+			return {this, next};
+		}
+		/// @brief 删除position之后的元素
+		iterator erase_after(const_iterator position)
+		{
+			if (position.index == npos || storage[position.index].next == npos)
+				throw std::out_of_range("Erase Failed: no element after position");
+			return erase({this, storage[position.index].next});
+		}
 
 	protected:
 		static size_t Index(size_t pos)
@@ -230,8 +738,8 @@ namespace Storage
 				throw std::out_of_range("size_t pos == 0");
 			return --pos;
 		}
-		void _Reset_Front() { front = npos; }
-		// 返回单链表第pos个元素节点的下标
+		void _Reset_Front() { front = rear = npos; }
+		// 返回单链表第pos个元素节点的下标，位于后半段时从rear向前查找
 		size_t _Element_Locate(size_t pos)
 		{
 			// 判断非空且不超过l->size
@@ -240,12 +748,46 @@ namespace Storage
 			if (pos > this->size)
 				throw std::out_of_range("LocateNode Faild: Position > List size");
 
-			NodeType &node = storage[front];
-			size_t index = front;
-			for (size_t i{}; i < pos; ++i, index = node.next)
-				;
+			size_t index;
+			if (pos <= this->size / 2 + 1)
+				for (index = front; --pos;)
+					index = storage[index].next;
+			else
+				for (index = rear; pos++ < this->size;)
+					index = storage[index].pre;
 			return index;
 		}
+		/// @brief 在已分配的index处构造节点，并链接到pre之后(pre为npos时作为首元节点)
+		template <typename Value>
+		void _Link(size_t index, size_t pre, Value &&element)
+		{
+			size_t next = pre == npos ? front : storage[pre].next;
+			storage[index] = NodeType(std::forward<Value>(element), pre, next);
+			(pre == npos ? front : storage[pre].next) = index;
+			(next == npos ? rear : storage[next].pre) = index;
+			++this->size;
+		}
+		// 将index处的节点从链中断开并归还空闲列表
+		void _Unlink(size_t index)
+		{
+			NodeType &node = storage[index];
+			(node.pre == npos ? front : storage[node.pre].next) = node.next;
+			(node.next == npos ? rear : storage[node.next].pre) = node.pre;
+			node = NodeType{}; // delete node
+			free_list.Deallocate(storage, index);
+			--this->size;
+		}
+		template <typename Value>
+		iterator _Insert_After(const_iterator position, Value &&element)
+		{
+			if (position.index == npos)
+				throw std::out_of_range("Insert Failed: position is end()");
+			if (this->size >= maxsize)
+				throw std::runtime_error("List insert failed: List is full");
+			size_t index = free_list.Allocate(storage);
+			_Link(index, position.index, std::forward<Value>(element));
+			return {this, index};
+		}
 
 	public:
 		// 清空线性表(删除所有节点)
@@ -254,6 +796,7 @@ namespace Storage
 			for (size_t i = 0; i < maxsize; i++)
 				storage[i]=NodeType{};
 			this->size = 0;
+			free_list = Free_List{};
 			_Reset_Front();
 		}
 		// 显示线性表所有内容
@@ -263,13 +806,11 @@ namespace Storage
 					  << "[front]: " << front << std::endl
 					  << "[size]: " << this->size << std::endl
 					  << "front->";
-			const NodeType *node = &storage[front];
-			size_t index{front};//记录当前节点的下标
+			size_t index{front}; // 记录当前节点的下标
 			for (size_t i = 1; i <= this->size; i++)
 			{
-				std::cout << '[' << i << ':' <<index<<':'<< node->element << "]->";
-				index = node->next;
-				node = &storage[node->next];
+				std::cout << '[' << i << ':' << index << ':' << storage[index].element << "]->";
+				index = storage[index].next;
 			}
 
 			std::cout << "npos\n";
@@ -285,10 +826,7 @@ namespace Storage
 		{
 			if (pos > this->size || pos < 1)
 				throw std::out_of_range("Position is not exist");
-			size_t index{front};
-			for (size_t i = 1; i < pos; ++i)
-				index = storage[index].next;
-			return storage[index].element;
+			return storage[_Element_Locate(pos)].element;
 		}
 
 		virtual void Element_Insert(size_t pos, const ElementType &element)
@@ -297,25 +835,8 @@ namespace Storage
 				throw std::out_of_range("List insert failed: Position out of range");
 			if (this->size >= maxsize)
 				throw std::runtime_error("List insert failed: List is full");
-
-			if (front == npos)
-			{
-				front = free_list.Allocate();
-				this->storage[front] = NodeType(element,npos,npos);
-			}
-			else
-			{
-				size_t index_left{front}, index_right{npos}, index_allocated{free_list.Allocate()};
-				// 找到pos插入位置附近的两个节点
-				for (size_t i = 1; i < pos - 1; i++)
-					index_left = storage[index_left].next;
-				index_right = storage[index_left].next;
-				storage[index_allocated] = NodeType(element, index_left, index_right);
-				storage[index_left].next = index_allocated;
-				if(index_right!= npos)
-					storage[index_right].pre = index_allocated;
-			}
-			++this->size;
+			size_t pre = pos == 1 ? npos : _Element_Locate(pos - 1);
+			_Link(free_list.Allocate(storage), pre, element);
 		}
 		virtual void Element_Insert(size_t pos, ElementType &&element)
 		{
@@ -323,35 +844,12 @@ namespace Storage
 				throw std::out_of_range("List insert failed: Position out of range");
 			if (this->size >= maxsize)
 				throw std::runtime_error("List insert failed: List is full");
-
-			if (front == npos)
-			{
-				front = free_list.Allocate();
-				this->storage[front] = NodeType(std::forward<ElementType>(element), npos, npos);
-			}
-			else
-			{
-				size_t index_left{front}, index_right{npos}, index_allocated{free_list.Allocate()};
-				// 找到pos插入位置附近的两个节点
-				for (size_t i = 1; i < pos - 1; i++)
-					index_left = storage[index_left].next;
-				index_right = storage[index_left].next;
-				storage[index_allocated] = NodeType(std::forward<ElementType>(element), index_left, index_right);
-				storage[index_left].next = index_allocated;
-				if (index_right != npos)
-					storage[index_right].pre = index_allocated;
-			}
-			++this->size;
+			size_t pre = pos == 1 ? npos : _Element_Locate(pos - 1);
+			_Link(free_list.Allocate(storage), pre, std::move(element));
 		}
 		virtual void Element_Delete(size_t pos)
 		{
-			size_t index = _Element_Locate(pos);
-			NodeType node = storage[index];
-			storage[node.pre].next = node.next;
-			storage[node.next].pre = node.pre;
-			storage[index]=NodeType{};//delete node
-			free_list.Deallocate(index);
-			--this->size;
+			_Unlink(_Element_Locate(pos));
 		}
 		virtual void Element_Update(size_t pos, ElementType &&elem) { operator[](pos) = std::forward<ElementType>(elem); }
 	};
@@ -364,34 +862,18 @@ namespace Storage
 ///  模板特例
 /// ——————————————————————————————————————————————————
 // 单链表(头节点)
-template <typename ElementType>
+/// @tparam AllocatorPolicy 节点分配策略，默认每个节点单独new/delete，Policy::Node_Pool<>使用节点池
+template <typename ElementType, typename AllocatorPolicy = Policy::Node_New>
 class Link_List_Forward
-	: public Storage::Link_List<List_Node_SingleWay<ElementType>, ElementType>
+	: public Storage::Link_List<List_Node_SingleWay<ElementType>, ElementType, AllocatorPolicy>
 {
 	using NodeType = List_Node_SingleWay<ElementType>;
+	using Base = Storage::Link_List<NodeType, ElementType, AllocatorPolicy>;
 
 public: /// 链表操作
 	Link_List_Forward() = default;
 	Link_List_Forward(std::initializer_list<ElementType> list)
-		: Storage::Link_List<NodeType, ElementType>(list.size())
-	{
-		NodeType *node = this->front;
-		for (const auto &element : list)
-		{
-			if (!node)
-			{
-				this->front = new NodeType(std::move(element), nullptr);
-				node = this->front; // node=nullptr时需要重新赋值，不然无效
-				continue;
-			}
-			node->next = new NodeType(std::move(element), nullptr);
-			node = node->next;
-		}
-	}
-	~Link_List_Forward()
-	{
-		this->List_Clear();
-	}
+		: Base(list) {}
 
 private:
 	// 定位并返回单链表第pos个元素节点
@@ -403,11 +885,7 @@ private:
 		if (pos > this->size)
 			throw std::out_of_range("LocateNode Faild: Position > List size");
 
-		NodeType *p = this->front;
-		for (size_t i = 1; i < pos; i++)
-		{ // 遍历定位到第pos个元素节点
-			p = p->next;
-		}
+		NodeType *p = this->_Cursor_Locate(pos); // 从front或游标遍历定位到第pos个元素节点
 		if (!p)
 			throw std::runtime_error("Element_Locate Failed: Node Unexist");
 		return p;
@@ -416,17 +894,7 @@ private:
 public:
 	void List_Clear() override
 	{
-		if (!this->Is_Empty())
-		{
-			NodeType *del;
-			while (this->front)
-			{
-				del = this->front;
-				this->front = this->front->next;
-				delete del;
-				--this->size;
-			}
-		}
+		this->_Nodes_Release();
 	}
 	void List_Show(const string &string) override
 	{
@@ -476,47 +944,50 @@ public: /// 元素操作
 	{
 		if (pos < 1 || pos > this->size + 1)
 			throw std::out_of_range("Insert Faild: Illegal position");
-		NodeType *p = new NodeType(element);
+		NodeType *p = this->allocator.Allocate(element);
 		if (pos == 1)
 		{
 			p->next = this->front;
 			this->front = p;
-			++this->size;
 		}
 		else
-		{
-			NodeType *p_pri;
-			p_pri = _Element_Locate(pos - 1);
+		{ // 尾插时前驱就是尾节点，不需要定位
+			NodeType *p_pri = pos == this->size + 1 ? this->rear : _Element_Locate(pos - 1);
 			p->next = p_pri->next;
 			p_pri->next = p;
-			++this->size;
 		}
+		if (!p->next)
+			this->rear = p;
+		++this->size;
+		this->_Cursor_Insert(pos);
 	}
 	void Element_Insert(size_t pos, ElementType &&element) override
 	{
 		if (pos < 1 || pos > this->size + 1)
 			throw std::out_of_range("Insert Faild: Illegal position");
-		NodeType *p = new NodeType(element); // move
+		NodeType *p = this->allocator.Allocate(std::move(element));
 		if (pos == 1)
 		{
 			p->next = this->front;
 			this->front = p;
-			++this->size;
 		}
 		else
-		{
-			NodeType *p_pri;
-			p_pri = _Element_Locate(pos - 1);
+		{ // 尾插时前驱就是尾节点，不需要定位
+			NodeType *p_pri = pos == this->size + 1 ? this->rear : _Element_Locate(pos - 1);
 			p->next = p_pri->next;
 			p_pri->next = p;
-			++this->size;
 		}
+		if (!p->next)
+			this->rear = p;
+		++this->size;
+		this->_Cursor_Insert(pos);
 	}
 	// 删除链表L的第pos个元素节点
 	void Element_Delete(size_t pos) override
 	{
-		// NodeType *node = Element_Locate(pos - 1);
-		NodeType *node = this->Element_Prior(_Element_Locate(pos));
+		if (pos < 1 || pos > this->size)
+			throw std::out_of_range("Delete Failed: Illegal position");
+		NodeType *node = pos == 1 ? nullptr : _Element_Locate(pos - 1); // 前驱节点
 		NodeType *del{};
 		if (!node) // 当前节点是首元节点
 		{
@@ -528,40 +999,27 @@ public: /// 元素操作
 			del = node->next;
 			node->next = del->next;
 		}
-		delete del;
+		if (del == this->rear)
+			this->rear = node;
+		this->allocator.Deallocate(del);
 		--this->size;
+		this->_Cursor_Erase(pos);
 	}
 };
 
 // 双向链表(头节点)
-template <typename ElementType>
+/// @tparam AllocatorPolicy 节点分配策略，默认每个节点单独new/delete，Policy::Node_Pool<>使用节点池
+template <typename ElementType, typename AllocatorPolicy = Policy::Node_New>
 class Link_List_Double
-	: public Storage::Link_List<List_Node_DoubleWay<ElementType>, ElementType>
+	: public Storage::Link_List<List_Node_DoubleWay<ElementType>, ElementType, AllocatorPolicy>
 {
 	using NodeType = List_Node_DoubleWay<ElementType>;
+	using Base = Storage::Link_List<NodeType, ElementType, AllocatorPolicy>;
 
 public:
 	Link_List_Double() = default;
 	Link_List_Double(std::initializer_list<ElementType> list)
-		: Storage::Link_List<NodeType, ElementType>(list.size())
-	{
-		NodeType *node = this->front;
-		for (const auto &element : list)
-		{
-			if (!node)
-			{
-				this->front = new NodeType(std::move(element), nullptr);
-				node = this->front; // node=nullptr时需要重新赋值，不然无效
-				continue;
-			}
-			node->next = new NodeType(std::move(element), nullptr);
-			node = node->next;
-		}
-	}
-	~Link_List_Double()
-	{
-		List_Clear();
-	}
+		: Base(list) {}
 
 private:
 	// 定位并返回单链表第pos个元素节点
@@ -572,28 +1030,13 @@ private:
 		if (pos > this->size)
 			throw std::out_of_range("LocateNode Faild: Position > List size");
 
-		NodeType *p = this->front;
-		for (size_t i = 1; i < pos; i++)
-		{ // 遍历定位到第pos个元素节点
-			p = p->next;
-		}
-		return p;
+		return this->_Cursor_Locate(pos); // 从front或游标双向遍历定位到第pos个元素节点
 	}
 
 public: /// 链表操作
 	void List_Clear() override
 	{
-		if (this->size <= 0)
-			return;
-
-		NodeType *del;
-		while (this->front)
-		{
-			del = this->front;
-			this->front = this->front->next;
-			delete del;
-			--this->size;
-		}
+		this->_Nodes_Release();
 	}
 	void List_Show(const string &string) override
 	{
@@ -636,27 +1079,29 @@ public: /// 元素操作
 			throw std::out_of_range("Insert Faild: Illegal position");
 		if (pos == 1)
 		{ /// 头插
-			NodeType *p = new NodeType(element, nullptr, this->front);
+			NodeType *p = this->allocator.Allocate(element, nullptr, this->front);
 			if (this->front)
 				this->front->pre = p;
+			else
+				this->rear = p;
 			this->front = p;
 		}
 		else if (pos == this->size + 1)
 		{ /// 尾插
-			NodeType *pre = this->front;
-			while (pre->next)
-				pre = pre->next;
-			NodeType *node = new NodeType(element, pre, nullptr);
+			NodeType *pre = this->rear;
+			NodeType *node = this->allocator.Allocate(element, pre, nullptr);
 			pre->next = node;
+			this->rear = node;
 		}
 		else
 		{ /// 中间插入
 			NodeType *node = _Element_Locate(pos);
-			NodeType *p = new NodeType(element, node->pre, node);
+			NodeType *p = this->allocator.Allocate(element, node->pre, node);
 			p->pre->next = p;
 			p->next->pre = p;
 		}
 		++this->size;
+		this->_Cursor_Insert(pos);
 	}
 	void Element_Insert(size_t pos, ElementType &&element) override
 	{
@@ -664,49 +1109,47 @@ public: /// 元素操作
 			throw std::out_of_range("Insert Faild: Illegal position");
 		if (pos == 1)
 		{ /// 头插
-			NodeType *p = new NodeType(element, nullptr, this->front);
+			NodeType *p = this->allocator.Allocate(std::move(element), nullptr, this->front);
 			if (this->front)
 				this->front->pre = p;
+			else
+				this->rear = p;
 			this->front = p;
 		}
 		else if (pos == this->size + 1)
 		{ /// 尾插
-			NodeType *pre = this->front;
-			while (pre->next)
-				pre = pre->next;
-			NodeType *node = new NodeType(element, pre, nullptr);
+			NodeType *pre = this->rear;
+			NodeType *node = this->allocator.Allocate(std::move(element), pre, nullptr);
 			pre->next = node;
+			this->rear = node;
 		}
 		else
 		{ /// 中间插入
 			NodeType *node = _Element_Locate(pos);
-			NodeType *p = new NodeType(element, node->pre, node);
+			NodeType *p = this->allocator.Allocate(std::move(element), node->pre, node);
 			p->pre->next = p;
 			p->next->pre = p;
 		}
 		++this->size;
+		this->_Cursor_Insert(pos);
 	}
 	// 删除链表L的第pos个元素节点
 	void Element_Delete(size_t pos) override
 	{
-		NodeType *node = _Element_Locate(pos);
+		NodeType *node = _Element_Locate(pos), *pre = node->pre;
 		if (pos == 1) // 删首元节点
-		{
 			this->front = node->next;
-			this->front->pre = nullptr;
-		}
 		else
-		{
-			if (!node->next) // 删尾节点
-				node->pre->next = nullptr;
-			else
-			{
-				node->next->pre = node->pre;
-				node->pre->next = node->next;
-			}
-		}
-		delete node;
+			pre->next = node->next;
+		if (node->next)
+			node->next->pre = pre;
+		else // 删尾节点
+			this->rear = pre;
+		this->allocator.Deallocate(node);
 		--this->size;
+		this->_Cursor_Erase(pos);
+		if (pre) // 游标停在前驱节点，便于连续删除
+			this->_Cursor_Set(pos - 1, pre);
 	}
 };
 
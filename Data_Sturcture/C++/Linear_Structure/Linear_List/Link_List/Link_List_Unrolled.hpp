@@ -0,0 +1,409 @@
+#pragma once
+
+#include <mutex> //call_once
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility> //exchange
+
+#include "../../List_Node.hpp"
+#include "../../List_Node_Allocator.hpp"
+#include "../Linear_List.hpp"
+
+/// ============================================================================================================
+/// 		展开链表(Unrolled Linked List)
+/// 每个节点连续存放最多capacity个元素，节点之间双向链接：
+/// 		1. 遍历时每capacity个元素才跳转一次节点，缓存局部性接近顺序表
+/// 		2. 插入/删除只移动一个节点内的元素，不移动整个表
+/// 节点维护规则(除尾节点外，每个节点至少有capacity/2个元素，空间利用率不低于50%)：
+/// 		插入：节点已满时，把后一半元素移到新建的后继节点(分裂)；在满节点末尾插入时直接新建后继节点
+/// 		删除：节点元素少于capacity/2时，与后继节点合并；合并后放不下时，从后继节点借元素
+/// ============================================================================================================
+
+/// @brief 双向展开链表
+/// @tparam capacity 每个节点的元素容量
+/// @tparam AllocatorPolicy 节点分配策略，见List_Node_Allocator.hpp
+template <typename ElementType, size_t capacity = 16, typename AllocatorPolicy = Policy::Node_New>
+class Link_List_Unrolled : public Logic::Linear_List<ElementType>
+{
+	static_assert(capacity >= 2, "Link_List_Unrolled: capacity must be at least 2");
+
+	using NodeType = List_Node_Unrolled<ElementType, capacity>;
+	using Node_Allocator = typename AllocatorPolicy::template Allocator<NodeType>;
+	static constexpr size_t half = capacity / 2; // 非尾节点的最少元素个数
+
+protected:
+	NodeType *front{};			// 首节点
+	NodeType *rear{};			// 尾节点
+	Node_Allocator allocator{}; // 节点分配器
+	size_t node_count{};		// 节点个数
+
+	/// 游标：缓存最近一次定位的节点，以及该节点之前的元素个数
+	/// cursor_node为nullptr表示游标无效
+	NodeType *cursor_node{};
+	size_t cursor_base{};
+
+	// 第pos个元素所在的节点和节点内下标
+	struct Location
+	{
+		NodeType *node;
+		size_t offset;
+	};
+
+protected: /// 节点维护
+	// 新建一个空节点，链接在pre之后(pre为nullptr时作为首节点)
+	NodeType *_Node_Insert_After(NodeType *pre)
+	{
+		NodeType *node = allocator.Allocate();
+		node->pre = pre;
+		node->next = pre ? pre->next : front;
+		(pre ? pre->next : front) = node;
+		(node->next ? node->next->pre : rear) = node;
+		++node_count;
+		return node;
+	}
+	// 断开并回收节点，同时析构节点中剩余的元素
+	void _Node_Remove(NodeType *node)
+	{
+		(node->pre ? node->pre->next : front) = node->next;
+		(node->next ? node->next->pre : rear) = node->pre;
+		allocator.Deallocate(node);
+		--node_count;
+	}
+	// 回收所有节点
+	void _Nodes_Release()
+	{
+		allocator.Release(front);
+		front = rear = nullptr;
+		node_count = 0;
+		this->size = 0;
+		cursor_node = nullptr;
+		cursor_base = 0;
+	}
+	// 把已满的node的后一半元素移到新建的后继节点
+	NodeType *_Node_Split(NodeType *node)
+	{
+		NodeType *next = _Node_Insert_After(node);
+		ElementType *data = node->elements.Data();
+		size_t keep = capacity - half;
+		std::uninitialized_move(data + keep, data + node->count, next->elements.Data());
+		std::destroy(data + keep, data + node->count);
+		next->count = node->count - keep;
+		node->count = keep;
+		return next;
+	}
+	// node的元素少于half时调用：与后继节点合并，放不下时从后继节点借元素，使node恢复到half个
+	void _Node_Rebalance(NodeType *node)
+	{
+		NodeType *next = node->next;
+		if (!next || node->count >= half)
+			return;
+		ElementType *data = node->elements.Data(), *data_next = next->elements.Data();
+		if (node->count + next->count <= capacity)
+		{ // 合并
+			std::uninitialized_move(data_next, data_next + next->count, data + node->count);
+			node->count += next->count;
+			_Node_Remove(next);
+			return;
+		}
+		size_t borrow = half - node->count;
+		std::uninitialized_move(data_next, data_next + borrow, data + node->count);
+		node->count += borrow;
+		std::move(data_next + borrow, data_next + next->count, data_next);
+		std::destroy(data_next + next->count - borrow, data_next + next->count);
+		next->count -= borrow;
+	}
+
+	/// @brief 定位第pos个元素(调用前已检查pos合法)，并将游标移到所在节点
+	/// @note 从front、rear和游标中选择距离最近的起点，沿节点跳转，每次跳过一整个节点
+	Location _Element_Locate(size_t pos)
+	{
+		NodeType *node = front;
+		size_t base = 0, distance = pos;
+		if (this->size - pos < distance)
+		{
+			node = rear;
+			base = this->size - rear->count;
+			distance = this->size - pos;
+		}
+		if (cursor_node && (pos > cursor_base ? pos - cursor_base : cursor_base - pos) < distance)
+		{
+			node = cursor_node;
+			base = cursor_base;
+		}
+		while (pos > base + node->count)
+		{
+			base += node->count;
+			node = node->next;
+		}
+		while (pos <= base)
+		{
+			node = node->pre;
+			base -= node->count;
+		}
+		cursor_node = node;
+		cursor_base = base;
+		return {node, pos - base - 1};
+	}
+
+	template <typename Value>
+	void _Element_Insert(size_t pos, Value &&element)
+	{
+		if (pos < 1 || pos > this->size + 1)
+			throw std::out_of_range("Insert Faild: Illegal position");
+		NodeType *node;
+		size_t base, offset;
+		if (pos == this->size + 1)
+		{ // 尾插不需要定位
+			node = rear ? rear : _Node_Insert_After(nullptr);
+			base = this->size - node->count;
+			offset = node->count;
+		}
+		else
+		{
+			Location location = _Element_Locate(pos);
+			node = location.node;
+			base = cursor_base;
+			offset = location.offset;
+		}
+
+		if (node->count == capacity)
+		{
+			if (offset == capacity)
+			{ // 在满节点末尾插入：新建后继节点，不移动元素
+				base += capacity;
+				node = _Node_Insert_After(node);
+				offset = 0;
+			}
+			else
+			{ // 分裂后插入到所在的一半
+				NodeType *next = _Node_Split(node);
+				if (offset > node->count)
+				{
+					offset -= node->count;
+					base += node->count;
+					node = next;
+				}
+			}
+		}
+
+		ElementType *data = node->elements.Data();
+		if (offset == node->count)
+			std::construct_at(data + offset, std::forward<Value>(element));
+		else
+		{ // element可能引用表中的元素，先构造再移动
+			ElementType temp(std::forward<Value>(element));
+			std::construct_at(data + node->count, std::move(data[node->count - 1]));
+			std::move_backward(data + offset, data + node->count - 1, data + node->count);
+			data[offset] = std::move(temp);
+		}
+		++node->count;
+		++this->size;
+		cursor_node = node;
+		cursor_base = base;
+	}
+
+	void _Copy_Elements(const Link_List_Unrolled &other)
+	{
+		for (NodeType *node = other.front; node; node = node->next)
+		{
+			NodeType *copy = _Node_Insert_After(rear);
+			std::uninitialized_copy_n(node->elements.Data(), node->count, copy->elements.Data());
+			copy->count = node->count;
+		}
+		this->size = other.size;
+	}
+	void _Move_Elements(Link_List_Unrolled &other)
+	{
+		front = std::exchange(other.front, nullptr);
+		rear = std::exchange(other.rear, nullptr);
+		allocator = std::move(other.allocator);
+		node_count = std::exchange(other.node_count, 0);
+		this->size = std::exchange(other.size, 0);
+		other.cursor_node = nullptr;
+		other.cursor_base = 0;
+	}
+
+public:
+	Link_List_Unrolled() = default;
+	Link_List_Unrolled(const Link_List_Unrolled<ElementType, capacity, AllocatorPolicy> &other)
+		: Logic::Linear_List<ElementType>()
+	{
+		_Copy_Elements(other);
+	}
+	Link_List_Unrolled(Link_List_Unrolled<ElementType, capacity, AllocatorPolicy> &&other)
+	{
+		_Move_Elements(other);
+	}
+	Link_List_Unrolled<ElementType, capacity, AllocatorPolicy> &
+	operator=(const Link_List_Unrolled<ElementType, capacity, AllocatorPolicy> &other)
+	{
+		if (this == &other)
+			throw std::logic_error("Self assignment");
+		_Nodes_Release();
+		_Copy_Elements(other);
+		return *this;
+	}
+	Link_List_Unrolled<ElementType, capacity, AllocatorPolicy> &
+	operator=(Link_List_Unrolled<ElementType, capacity, AllocatorPolicy> &&other)
+	{
+		if (this == &other)
+			throw std::logic_error("Self assignment");
+		_Nodes_Release();
+		_Move_Elements(other);
+		return *this;
+	}
+	Link_List_Unrolled(std::initializer_list<ElementType> list)
+	{
+		for (const auto &element : list)
+			_Element_Insert(this->size + 1, element);
+	}
+	virtual ~Link_List_Unrolled() { _Nodes_Release(); }
+
+public: /// 迭代器
+	/// @brief 节点内按下标、节点间沿next/pre遍历的双向迭代器，end()的节点为nullptr
+	/// @tparam is_const 为true时是const_iterator
+	template <bool is_const>
+	class Iterator
+	{
+		friend class Link_List_Unrolled;
+		using Node_Pointer = std::conditional_t<is_const, const NodeType *, NodeType *>;
+		using List_Pointer = std::conditional_t<is_const, const Link_List_Unrolled *, Link_List_Unrolled *>;
+
+		Node_Pointer node{};
+		size_t offset{};
+		List_Pointer list{};
+
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = ElementType;
+		using difference_type = std::ptrdiff_t;
+		using pointer = std::conditional_t<is_const, const ElementType *, ElementType *>;
+		using reference = std::conditional_t<is_const, const ElementType &, ElementType &>;
+
+		Iterator() = default;
+		Iterator(Node_Pointer node, size_t offset, List_Pointer list) : node{node}, offset{offset}, list{list} {}
+		// iterator可以隐式转换为const_iterator
+		template <bool other_const>
+			requires(is_const && !other_const)
+		Iterator(const Iterator<other_const> &other) : node{other.node}, offset{other.offset}, list{other.list} {}
+
+		reference operator*() const { return node->elements[offset]; }
+		pointer operator->() const { return &node->elements[offset]; }
+		Iterator &operator++()
+		{
+			if (++offset == node->count)
+			{
+				node = node->next;
+				offset = 0;
+			}
+			return *this;
+		}
+		Iterator operator++(int)
+		{
+			Iterator temp = *this;
+			++*this;
+			return temp;
+		}
+		Iterator &operator--()
+		{
+			if (!node || offset == 0)
+			{
+				node = node ? node->pre : list->rear;
+				offset = node->count;
+			}
+			--offset;
+			return *this;
+		}
+		Iterator operator--(int)
+		{
+			Iterator temp = *this;
+			--*this;
+			return temp;
+		}
+		bool operator==(const Iterator &other) const { return node == other.node && offset == other.offset; }
+
+		template <bool>
+		friend class Iterator;
+	};
+	using iterator = Iterator<false>;
+	using const_iterator = Iterator<true>;
+
+	iterator begin() { return {front, 0, this}; }
+	iterator end() { return {nullptr, 0, this}; }
+	const_iterator begin() const { return {front, 0, this}; }
+	const_iterator end() const { return {nullptr, 0, this}; }
+	const_iterator cbegin() const { return begin(); }
+	const_iterator cend() const { return end(); }
+
+public: /// 链表操作
+	// 清空线性表(删除所有节点)
+	void List_Clear() override
+	{
+		_Nodes_Release();
+	}
+	void List_Show(const string &string = "") override
+	{
+		std::cout << string << std::endl
+				  << "[front]: " << front << std::endl
+				  << "[size]: " << this->size << std::endl
+				  << "[nodes]: " << node_count << std::endl
+				  << "front->";
+		size_t index{};
+		for (NodeType *node = front; node; node = node->next)
+		{
+			std::cout << '[' << ++index << ':';
+			for (size_t i = 0; i < node->count; i++)
+				std::cout << (i ? " " : "") << node->elements[i];
+			std::cout << "]->";
+		}
+		std::cout << "nullptr\n";
+
+		static std::once_flag show_node_format;
+		std::call_once(show_node_format, []()
+					   { std::cout << "Node format=[node:elements...]" << std::endl; });
+	}
+	// 已分配的元素空间(节点个数*节点容量)
+	size_t Get_Capcity() const { return node_count * capacity; }
+	size_t Get_Node_Count() const { return node_count; }
+
+	// 定位元素
+	ElementType &operator[](size_t pos) override
+	{
+		if (pos < 1 || pos > this->size)
+			throw std::out_of_range("Position is not exist");
+		Location location = _Element_Locate(pos);
+		return location.node->elements[location.offset];
+	}
+
+public: /// 元素操作
+	void Element_Insert(size_t pos, const ElementType &element) override { _Element_Insert(pos, element); }
+	void Element_Insert(size_t pos, ElementType &&element) override { _Element_Insert(pos, std::move(element)); }
+	// 删除第pos个元素，节点元素过少时合并或借元素
+	void Element_Delete(size_t pos) override
+	{
+		if (pos < 1 || pos > this->size)
+			throw std::out_of_range("Delete Failed: Illegal position");
+		auto [node, offset] = _Element_Locate(pos);
+		ElementType *data = node->elements.Data();
+		std::move(data + offset + 1, data + node->count, data + offset);
+		std::destroy_at(data + --node->count);
+		--this->size;
+
+		if (node->count == 0)
+		{ // 游标退到前驱节点
+			cursor_node = node->pre;
+			cursor_base = node->pre ? cursor_base - node->pre->count : 0;
+			_Node_Remove(node);
+		}
+		else
+			_Node_Rebalance(node); // 只合并或借入后继节点，node之前的元素个数不变，游标仍然有效
+	}
+	void Element_Update(size_t pos, ElementType &&elem) override { operator[](pos) = std::forward<ElementType>(elem); }
+};
+
+#if __cplusplus >= 202002L
+#include "../ADT.hpp"
+static_assert(ADT::Linear_List<Link_List_Unrolled<int>, int>);
+#endif
@@ -3,9 +3,13 @@
 #include <math.h>
 #include <sstream>
 #include "../../List_Node.hpp"
+#include "../../List_Node_Allocator.hpp"
+#include "Skip_List_Random.hpp"
 #include <optional>
 #include <vector>
-#include <map>
+#include <array>
+#include <iterator>
+#include <ranges>
 
 #include "../Linear_List.hpp"
 
@@ -24,8 +28,13 @@
 /// 删除：定位O(logn) x 删除节点O(1) = O(logn)
 ///
 /// 实现细节
-/// - 支持动态扩展高度，使用vector作为头结点
-/// - 由于搜索时申请释放的数组用于保存每层节点的前驱开销极大，
+/// - 支持动态扩展高度，使用vector作为头结点，最多max_level层
+/// - 插入删除时每层的前驱(搜索路径)保存在栈上长为max_level的数组中，不申请堆空间
+/// - 节点的指针数组紧跟在元素之后，一次分配；节点按层数分级，从节点池中分配
+/// - 节点层数由随机数源一次生成，默认使用线程局部的xorshift64*，见Skip_List_Random.hpp
+/// - 从有序序列批量构造：从左到右一趟链接所有层，O(n)
+/// - 每层的指针带有跨度(与redis zskiplistLevel::span相同)，按排名访问：
+///   Rank/Select O(logn)，Range/Range_By_Rank定位O(logn)，返回第0层上的迭代器区间，遍历k个元素O(k)
 /// - 如果使用首元节点，则使用单链节点实现的逻辑简单
 /// ============================================================================================================
 
@@ -33,98 +42,183 @@ namespace Storage
 {
 
     // 实现参考 redis zset、《数据结构、算法与应用 C++语言描述 》10.4 跳表表示
-    template <typename ElementType = int, float probable = 0.5f>
+    /// @tparam RandomSource 随机数源，每次调用返回一个64位随机数
+    template <typename ElementType = int, float probable = 0.5f, typename RandomSource = Random::Thread_Local<>>
     class Skip_List : public Logic::Skip_List<ElementType>
     {
     public:
-        using Node = List_Node_Skiplist<ElementType>;
+        using Node = List_Node_Skiplist_Inline<ElementType>;
+        static constexpr size_t max_level = 32; // 最大层数，n个元素约需要log(1/probable)n层
 
     protected:
         std::vector<Node *> header; // 头结点指针数组。支持层级扩展。header.size() == this->level   头结点的元素个数等于当前层数
-        Node *tail;                 // 尾结点指针
+        std::array<size_t, max_level> header_span{}; // 头结点每层的跨度，只有[0,level]层有效
+        Node *tail{};               // 尾结点指针
+        Policy::Node_Pool_Sized<>::Allocator<Node, max_level> allocator; // 以节点的最高层数作为大小级别
+        [[no_unique_address]] RandomSource random;                       // 决定新节点的层数
 
-        /// @brief
-        /// 用于搜索目标节点时保存每层最后一个节点的搜索路径。
-        /// search,insert,delete都需要用到
-        ///
-        /// 空间比当前level高一层因为可能新节点会使跳表的高度增加
-        /// - 需要操作跳表时由_Loacte_Previous_Node()更新维护
-        mutable std::map<size_t, Node *> search_path{};
+    public:
+
+        /// @brief 搜索路径：search_path[i]为第i层最后一个小于目标元素的节点，nullptr表示头结点
+        /// search,insert,delete都需要用到，只有[0,level]层有效
+        /// 由_Locate_Previous_Node()填写，作为局部变量存放在栈上
+        using Search_Path = std::array<Node *, max_level>;
+        /// @brief 搜索路径上每个节点的排名，头结点为0
+        using Rank_Path = std::array<size_t, max_level>;
+
+        /// @brief 批量构造时节点层数的分配方式
+        enum class Level_Assignment
+        {
+            Random,       // 与逐个插入相同，由随机数源决定
+            Deterministic // 按排名r分配：r能被(1/probable)^k整除时为第k层，各层完全均匀
+        };
 
     public:
-        Skip_List()
+        Skip_List() : Skip_List(RandomSource{}) {}
+        /// @param random 指定随机数源，如带种子的Random::Xorshift64，使节点层数可复现
+        explicit Skip_List(RandomSource random) : random(std::move(random))
         {
             static_assert(probable > 0 && probable < 1, "probable must be in (0, 1)");
-            header.resize(32, {}); // 预留32层的头结点
+            header.resize(max_level, {}); // 预留max_level层的头结点
+            header_span[0] = 1;           // 空表的尾后位置排名为1
+        }
+        /// @brief 从严格递增的序列批量构造，从左到右一趟链接所有层，O(n)
+        /// @param assignment 节点层数的分配方式
+        /// @exception std::invalid_argument 序列不是严格递增
+        template <std::input_iterator Iterator, std::sentinel_for<Iterator> Sentinel>
+        Skip_List(Iterator first, Sentinel last, Level_Assignment assignment = Level_Assignment::Random, RandomSource random = {})
+            : Skip_List(std::move(random)) // 委托构造完成后，抛出异常时析构函数会释放已链接的节点
+        {
+            Search_Path previous{}; // 每层最后一个节点，nullptr表示头结点
+            Rank_Path previous_rank{};
+            size_t top{}; // 已出现的最高层数
+            for (; first != last; ++first)
+            {
+                size_t rank = this->size + 1;
+                size_t level_target = assignment == Level_Assignment::Random ? Random::Level<probable>(this->random, max_level - 1)
+                                                                             : _Deterministic_Level(rank);
+                Node *node = allocator.Allocate(level_target, *first, level_target);
+                if (previous[0] && !(previous[0]->element < node->element))
+                {
+                    allocator.Deallocate(node, level_target);
+                    throw std::invalid_argument("Construct Failed: elements are not strictly increasing");
+                }
+                for (size_t i = 0; i <= level_target; ++i) // 链接到每层最后一个节点之后
+                {
+                    (previous[i] ? previous[i]->next[i] : header[i]) = node;
+                    _Span(previous[i], i) = rank - previous_rank[i];
+                    previous[i] = node;
+                    previous_rank[i] = rank;
+                }
+                top = level_target > top ? level_target : top;
+                tail = node;
+                ++this->size;
+                this->level = top;
+            }
+            for (size_t i = 0; i <= top; ++i) // 每层最后一个节点的后继为尾后位置
+                _Span(previous[i], i) = this->size + 1 - previous_rank[i];
         }
         ~Skip_List() override
         {
-            // 删除所有结点和数组
-
-            Node *node{header[0]};
-            // 从headerNode开始，延数对链的方向删除
-            while (node)
+            // 析构所有结点，内存由allocator整体释放
+            if constexpr (!std::is_trivially_destructible_v<ElementType>)
             {
-                Node *node_delete = node;
-                node = node->next[0];
-                delete node_delete;
+                Node *node{header[0]};
+                // 从headerNode开始，延数对链的方向析构
+                while (node)
+                    std::destroy_at(std::exchange(node, node->next[0]));
             }
         }
 
     private:
         // 随机一个元素所在的层级，用于计算实际的索引层数
-        int _Determine_Level() const
+        int _Determine_Level()
         {
-            // 获取一个表示链表级且不大于max_level的随机数
-            static constexpr auto threshold = RAND_MAX * probable;
-            int lev{}; // 0层作为最底层存放元素
-
-            // lev限制在[0,level]中，防止lev远超过当前level过多，如当前skip_list3层，获取了一个60层的结果，则4-59层的链表都是空的
-            // 使用while+随机计算lev可以控制每一层的节点的数量
-            while (lev <= this->level && rand() <= threshold)
-                ++lev;
-            return lev; // 返回的结果∈[0,level+1] level+1表示向上增加一层
+            // lev限制在[0,level+1]中，防止lev远超过当前level过多，如当前skip_list3层，获取了一个60层的结果，则4-59层的链表都是空的
+            // 每升一层的概率为probable，可以控制每一层的节点的数量
+            size_t limit = this->level + 1 < max_level ? this->level + 1 : max_level - 1;
+            return static_cast<int>(Random::Level<probable>(random, limit)); // 返回的结果∈[0,level+1] level+1表示向上增加一层
         }
 
-        // 更新last_node_at_level： 搜索目标元素并把在每一级链表搜索时遇到的最后一个结点存储起来
-        // 返回插入节点的前一个节点，可能等值
-        void _Loacte_Previous_Node(const ElementType &element) const
+        /// 确定性的层数：排名能被(1/probable)^k整除的最大k
+        static size_t _Deterministic_Level(size_t rank)
         {
-            search_path.clear(); // 清空上次操作的搜索路径
-
-            // 从最高级链表开始查找，在每一级链表中，从左边尽可能逼近要查找的记录
-            // 和Search逻辑比较类型，但是多了更新search_path的操作
+            static constexpr size_t base = static_cast<size_t>(1 / static_cast<double>(probable) + 0.5);
+            size_t level{};
+            if constexpr (base > 1)
+                for (; rank % base == 0 && level + 1 < max_level; rank /= base)
+                    ++level;
+            return level;
+        }
 
-            if (this->size == 0) // 跳表空时后续逻辑处理不了
+    protected:
+        /// @brief 节点(nullptr表示头结点)第i层的跨度：沿第i层到下一个节点，在第0层经过的节点数
+        /// 下一个节点为空时，视为排名size+1的节点
+        size_t &_Span(Node *node, size_t i) { return node ? node->Span(i) : header_span[i]; }
+        size_t _Span(const Node *node, size_t i) const { return node ? node->Span(i) : header_span[i]; }
+
+        /// @brief 搜索目标元素，把在每一级链表搜索时遇到的最后一个小于element的结点存入search_path，排名存入rank_path
+        /// @note 从最高层开始，每一层从上一层停下的节点继续向后，而不是从头结点重新开始
+        void _Locate_Previous_Node(const ElementType &element, Search_Path &search_path, Rank_Path &rank_path) const
+        {
+            Node *node{}; // 当前层最后一个小于element的节点，nullptr表示头结点
+            size_t rank{};
+            for (int i = static_cast<int>(this->level); i >= 0; --i)
             {
-                search_path[0] = nullptr;
-                return;
+                Node *next = node ? node->next[i] : header[i];
+                while (next && next->element < element)
+                {
+                    rank += _Span(node, i);
+                    node = next;
+                    next = node->next[i];
+                }
+                search_path[i] = node;
+                rank_path[i] = rank;
             }
+        }
+        void _Locate_Previous_Node(const ElementType &element, Search_Path &search_path) const
+        {
+            Rank_Path rank_path;
+            _Locate_Previous_Node(element, search_path, rank_path);
+        }
 
-            int level_start{static_cast<int>(this->level)};
-            // 处理element小于最高节点的情况
-            // 从第一个元素小于element的层开始向后遍历单链表
-            while (level_start >= 0 && header[level_start]->element > element)
+        /// @brief 第一个不满足before(element)的节点及其排名，不存在时为{nullptr, size+1}
+        template <typename Before>
+        std::pair<Node *, size_t> _Bound(Before before) const
+        {
+            Node *node{};
+            size_t rank{};
+            for (int i = static_cast<int>(this->level); i >= 0; --i)
             {
-                search_path[level_start] = nullptr;
-                --level_start;
+                Node *next = node ? node->next[i] : header[i];
+                while (next && before(next->element))
+                {
+                    rank += _Span(node, i);
+                    node = next;
+                    next = node->next[i];
+                }
             }
+            return {node ? node->next[0] : header[0], rank + 1};
+        }
 
-            for (int i = level_start; i >= 0; --i)
+        /// @brief 排名为rank的节点，rank∈[1,size]
+        Node *_Node_At(size_t rank) const
+        {
+            Node *node{};
+            size_t traversed{};
+            for (int i = static_cast<int>(this->level); i >= 0; --i)
             {
-                Node *node = header[i];
-                if (node->element == element) // 第一个节点就是目标节点
+                Node *next = node ? node->next[i] : header[i];
+                while (next && traversed + _Span(node, i) <= rank)
                 {
-                    search_path[i] = nullptr;
-                    continue; // 不用return是因为要把下层的previous_node也更新到search_path中
+                    traversed += _Span(node, i);
+                    node = next;
+                    next = node->next[i];
                 }
-                // 定位到当层最接近的前驱节点。
-                while (node->next[i] && node->next[i]->element < element)
-                    node = node->next[i];
-                // if (node->next[i] && node->next[i]->element == element)
-                //     throw std::runtime_error("Key already exists");
-                search_path[i] = node;
+                if (traversed == rank)
+                    return node;
             }
+            return nullptr;
         }
 
     public:
@@ -133,20 +227,17 @@ namespace Storage
         std::optional<ElementType> Element_Search(const ElementType &element) const override // O(logn)
         {
             // 从最高级链表开始查找，在每一级链表中，从左边尽可能逼近要查找的记录
-            size_t level_start{this->level};
-            // 处理element小于最高节点的情况
-            // 从第一个元素小于element的层开始向后遍历单链表
-            while (level_start != 0 && header[level_start]->element > element)
-                --level_start;
-            Node *node = header[level_start];
-
-            for (int i = level_start; i >= 0; --i)
+            Node *node{};
+            for (int i = static_cast<int>(this->level); i >= 0; --i)
             {
-                // 定位到当层最接近的节点。(小于目标的最大元素)
-                while (node->next[i] && node->element < element)
-                    node = node->next[i];
-                if (node->element == element)
-                    return node->element;
+                Node *next = node ? node->next[i] : header[i];
+                while (next && next->element < element)
+                {
+                    node = next;
+                    next = node->next[i];
+                }
+                if (next && next->element == element)
+                    return next->element;
             }
             return std::nullopt;
         }
@@ -156,8 +247,11 @@ namespace Storage
         {
 
             // 查看和插入数对相同关键字的数对是否已经存在
-            _Loacte_Previous_Node(element); // 定位到插入的节点位置
-            if (!search_path.empty() && !search_path.contains(0) && search_path[0] != header[0] && search_path[0] != tail && search_path[0]->next[0]->element == element)
+            Search_Path search_path;
+            Rank_Path rank_path;
+            _Locate_Previous_Node(element, search_path, rank_path); // 定位到插入的节点位置
+            Node *next = search_path[0] ? search_path[0]->next[0] : header[0];
+            if (next && next->element == element)
                 throw std::runtime_error("Key already exists");
 
             // 如果不存在，则确定新结点所在的级链表
@@ -165,33 +259,36 @@ namespace Storage
             // 保证级theLevel <= levels + 1
             if (level_target > this->level) // 如果计算的层级结果大于当前的最大层级，则跳表增加一个层级
             {
-                ++this->level; // 插入元素最多+1层，但是删除时可以一次减少多层
-                // previous_node.push_back(header); // 添加了一层，则最顶层的前驱必定为header。用于后续的顶层节点插入
-                if (header.size() < this->level + 1) // 头结点层数个数 < 需要的层数 ： size从1起始，level从0起始
-                {
-                    header.emplace_back(nullptr);
-                    search_path[this->level] = nullptr;
-                }
+                ++this->level;                      // 插入元素最多+1层，但是删除时可以一次减少多层
+                search_path[this->level] = nullptr; // 新的一层为空，前驱为头结点
+                rank_path[this->level] = 0;
+                header_span[this->level] = this->size + 1;
             }
 
             // 在结点theNode之后插入新结点
-            Node *node = new Node(element, level_target);
+            Node *node = allocator.Allocate(level_target, element, level_target);
+            size_t rank = rank_path[0] + 1; // 新节点的排名
             for (int i = 0; i <= level_target; ++i)
             {
+                // 前驱的跨度被新节点分成两段，新节点之后的节点排名+1
+                size_t &span = _Span(search_path[i], i);
+                node->Span(i) = rank_path[i] + span + 1 - rank;
+                span = rank - rank_path[i];
+
                 // 自下而上，插入i级链表
-                if (i < search_path.size() && search_path.contains(i) && search_path[i] != nullptr)
-                { // 当前层非空
+                if (search_path[i])
+                { // 前驱是元素节点
                     node->next[i] = search_path[i]->next[i];
                     search_path[i]->next[i] = node;
                 }
                 else
-                {
-                    if (header.empty() || header.size() < i) // 在新层插入时先添加一个元素
-                        header.emplace_back(nullptr);
-                    node->next[i] = header[i]; // header[i]就是刚刚emplace_back(nullptr)
+                { // 前驱是头结点
+                    node->next[i] = header[i];
                     header[i] = node;
                 }
             }
+            for (size_t i = level_target + 1; i <= this->level; ++i) // 更高层跨过了新节点
+                ++_Span(search_path[i], i);
             if (!node->next[0])
                 tail = node;
 
@@ -204,7 +301,8 @@ namespace Storage
         {
 
             // 查看是否存在关键字匹配的数对
-            _Loacte_Previous_Node(element);
+            Search_Path search_path;
+            _Locate_Previous_Node(element, search_path);
             Node *previous_node = search_path[0];
 
             // Node *node_delete = search_path.contains(0) ? search_path[0]->next[0] : header[0];
@@ -236,19 +334,98 @@ namespace Storage
                     search_path[i]->next[i] = node_delete->next[i];
                 else
                     header[i] = node_delete->next[i];
+                _Span(search_path[i], i) += node_delete->Span(i) - 1; // 前驱接上被删节点的跨度
             }
+            for (size_t i = node_delete->level + 1; i <= this->level; ++i) // 更高层跨过了被删节点
+                --_Span(search_path[i], i);
 
             if (node_delete->next[0] == nullptr) // 删除尾节点，更新tail
                 tail = search_path[0];
 
-            delete node_delete;
+            allocator.Deallocate(node_delete, node_delete->level);
             --this->size;
 
-            if (decrease_level && this->size) // size用于防止删除最后一个元素时，level减为-1
-            {
+            if (this->size == 0) // 删除最后一个元素时，level回到0，避免空的高层头结点
+                this->level = 0;
+            else
                 this->level -= decrease_level;
-                // search_path.resize(level + 1);//缩容
+        }
+
+    public:
+        /// @brief 第0层上的只读前向迭代器，按元素从小到大遍历。元素是排序的关键字，不能修改
+        class Iterator
+        {
+            const Node *node{};
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = ElementType;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const ElementType *;
+            using reference = const ElementType &;
+
+            Iterator() = default;
+            explicit Iterator(const Node *node) : node{node} {}
+
+            reference operator*() const { return node->element; }
+            pointer operator->() const { return &node->element; }
+            Iterator &operator++()
+            {
+                node = node->next[0];
+                return *this;
+            }
+            Iterator operator++(int)
+            {
+                Iterator temp = *this;
+                node = node->next[0];
+                return temp;
             }
+            bool operator==(const Iterator &other) const { return node == other.node; }
+        };
+        using iterator = Iterator;
+        using const_iterator = Iterator;
+        /// @brief Range/Range_By_Rank的结果，[begin,end)为第0层上的一段连续节点
+        using Range_View = std::ranges::subrange<Iterator>;
+
+        Iterator begin() const { return Iterator{header[0]}; }
+        Iterator end() const { return Iterator{}; }
+
+        /// @brief 元素的排名(从1开始)，不存在时返回0
+        size_t Rank(const ElementType &element) const // O(logn)
+        {
+            auto [node, rank] = _Bound([&](const ElementType &other) { return other < element; });
+            return node && node->element == element ? rank : 0;
+        }
+        /// @brief 排名为rank的元素，rank∈[1,size]
+        const ElementType &Select(size_t rank) const // O(logn)
+        {
+            if (rank < 1 || rank > this->size)
+                throw std::out_of_range("Select Failed: Illegal rank");
+            return _Node_At(rank)->element;
+        }
+        /// @brief 值在[lower,upper]中的所有元素
+        Range_View Range(const ElementType &lower, const ElementType &upper) const // O(logn+k)
+        {
+            Node *first = _Bound([&](const ElementType &other) { return other < lower; }).first;
+            Node *last = _Bound([&](const ElementType &other) { return !(upper < other); }).first;
+            if (upper < lower)
+                last = first;
+            return {Iterator{first}, Iterator{last}};
+        }
+        /// @brief 排名在[first,last]中的所有元素，last超过size时截断到size
+        Range_View Range_By_Rank(size_t first, size_t last) const // O(logn+k)
+        {
+            if (first < 1)
+                throw std::out_of_range("Range Failed: Illegal rank");
+            if (last > this->size)
+                last = this->size;
+            if (first > last)
+                return {end(), end()};
+            Node *node_first = _Node_At(first);
+            Node *node_last = node_first; // 区间内的元素反正要遍历，沿第0层走到区间末尾，不再从头定位
+            for (size_t rank = first; rank <= last; ++rank)
+                node_last = node_last->next[0];
+            return {Iterator{node_first}, Iterator{node_last}};
         }
 
     public:
@@ -280,8 +457,8 @@ namespace Storage
 }
 
 // 默认的实现方式
-template <typename ElementType = int, float probable = 0.5f>
-using Skip_List = Storage::Skip_List<ElementType, probable>;
+template <typename ElementType = int, float probable = 0.5f, typename RandomSource = Random::Thread_Local<>>
+using Skip_List = Storage::Skip_List<ElementType, probable, RandomSource>;
 
 #if __cplusplus >= 202002L
 #include "../ADT.hpp"
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <new> //operator new
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include "../../List_Node.hpp"
+#include "../../Memory_Reclamation.hpp"
+#include "Skip_List_Random.hpp"
+
+/// ============================================================================================================
+/// 无锁并发跳表，多个线程可以同时查找、插入、删除
+/// 实现参考 Herlihy, Shavit《The Art of Multiprocessor Programming》14.4 LockFreeSkipList、Fraser《Practical lock-freedom》
+/// - 每个节点的next[i]是带删除标记的原子指针：标记置位后，该层的后继不能再被修改
+/// - 插入：先在第0层CAS链接(线性化点)，再自下而上逐层链接
+/// - 删除：先自上而下标记第1层及以上，再标记第0层(线性化点，只有一个线程成功)，最后由_Find()摘除
+/// - 查找：只读遍历，跳过已标记的节点，不修改结构，不会失败重试
+/// - _Find()遍历时遇到已标记的节点就把它从该层摘除，CAS失败时从头重新查找
+///
+/// 内存回收
+/// - 节点从结构上摘除后，其他线程可能还在遍历它，交给Reclamation::Epoch_Domain在安全后释放
+/// - 插入线程可能在删除线程摘除之后才链接较高的层，所以插入和删除线程各持有节点的一个引用：
+///   插入线程链接完所有层后、删除线程摘除后各释放一次，两者都完成后节点才真正不可达，由最后释放的线程回收
+///
+/// 与Storage::Skip_List的区别
+/// - Try_Insert/Try_Delete返回是否成功：并发时无法先检查再操作，元素重复或不存在是正常结果
+///   Element_Insert/Element_Delete与Skip_List相同，失败时抛出异常
+/// - Get_Size在并发修改时只是近似值；层数只增不减
+/// - RandomSource必须可以被多个线程同时调用，默认的Random::Thread_Local<>满足
+/// ============================================================================================================
+
+namespace Storage
+{
+	template <typename ElementType = int, float probable = 0.5f, typename RandomSource = Random::Thread_Local<>>
+	class Skip_List_Concurrent
+	{
+	public:
+		using Node = List_Node_Skiplist_Concurrent<ElementType>;
+		static constexpr size_t max_level = 32;
+
+	private:
+		using Search_Path = std::array<Node *, max_level>;
+		static constexpr uintptr_t mark = 1;
+
+		std::atomic<uintptr_t> header[max_level]{}; // 头结点每层的后继
+		std::atomic<size_t> level{};				// 当前最高层数
+		std::atomic<size_t> size{};
+		[[no_unique_address]] RandomSource random;
+
+	private:
+		static Node *_Pointer(uintptr_t link) { return reinterpret_cast<Node *>(link & ~mark); }
+		static bool _Is_Marked(uintptr_t link) { return link & mark; }
+		static uintptr_t _Link(Node *node) { return reinterpret_cast<uintptr_t>(node); }
+		/// 节点(nullptr表示头结点)第i层的后继
+		std::atomic<uintptr_t> &_Next(Node *node, size_t i) { return node ? node->next[i] : header[i]; }
+
+		static Node *_Node_Create(const ElementType &element, size_t level)
+		{
+			void *memory = ::operator new(Node::Bytes(level));
+			try
+			{
+				return std::construct_at(static_cast<Node *>(memory), element, level);
+			}
+			catch (...)
+			{
+				::operator delete(memory);
+				throw;
+			}
+		}
+		static void _Node_Destroy(void *memory)
+		{
+			std::destroy_at(static_cast<Node *>(memory));
+			::operator delete(memory);
+		}
+		/// 插入线程和删除线程各释放一次，最后一次释放时节点已不可达，交给回收域
+		static void _Node_Release(Node *node)
+		{
+			if (node->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				Reclamation::Epoch_Domain::Global().Retire(node, _Node_Destroy);
+		}
+
+		/// 新节点的层数不超过当前层数+1，需要时提升当前层数
+		size_t _Determine_Level()
+		{
+			size_t current = level.load(std::memory_order_relaxed);
+			size_t level_target = Random::Level<probable>(random, current + 1 < max_level ? current + 1 : max_level - 1);
+			while (level_target > current && !level.compare_exchange_weak(current, level_target, std::memory_order_relaxed))
+				;
+			return level_target;
+		}
+
+		/// @brief 查找每层最后一个小于element的节点preds[i]及其后继succs[i]，同时摘除路径上已标记的节点
+		/// @return 第0层是否存在未标记的element
+		/// @note 调用前需已进入回收域的Guard
+		bool _Find(const ElementType &element, Search_Path &preds, Search_Path &succs)
+		{
+		retry:
+			Node *pred{};
+			for (int i = static_cast<int>(level.load(std::memory_order_acquire)); i >= 0; --i)
+			{
+				Node *curr = _Pointer(_Next(pred, i).load(std::memory_order_acquire));
+				while (curr)
+				{
+					uintptr_t succ = curr->next[i].load(std::memory_order_acquire);
+					if (_Is_Marked(succ))
+					{ // curr已被删除，从第i层摘除。pred被删除或pred的后继已改变时CAS失败
+						uintptr_t expected = _Link(curr);
+						if (!_Next(pred, i).compare_exchange_strong(expected, succ & ~mark, std::memory_order_acq_rel, std::memory_order_relaxed))
+							goto retry;
+						curr = _Pointer(succ);
+						continue;
+					}
+					if (!(curr->element < element))
+						break;
+					pred = curr;
+					curr = _Pointer(succ);
+				}
+				preds[i] = pred;
+				succs[i] = curr;
+			}
+			return succs[0] && !(element < succs[0]->element);
+		}
+
+	public:
+		Skip_List_Concurrent() = default;
+		explicit Skip_List_Concurrent(RandomSource random) : random(std::move(random)) {}
+		Skip_List_Concurrent(const Skip_List_Concurrent &) = delete;
+		Skip_List_Concurrent &operator=(const Skip_List_Concurrent &) = delete;
+		/// 析构时不能有其他线程正在访问。已删除的节点都已摘除并交给回收域，第0层上只剩未删除的节点
+		~Skip_List_Concurrent()
+		{
+			for (Node *node = _Pointer(header[0].load(std::memory_order_acquire)); node;)
+			{
+				Node *next = _Pointer(node->next[0].load(std::memory_order_relaxed));
+				_Node_Destroy(node);
+				node = next;
+			}
+		}
+
+	public:
+		bool Is_Empty() const { return Get_Size() == 0; }
+		size_t Get_Size() const { return size.load(std::memory_order_relaxed); }
+
+		/// @brief 查找元素，返回元素的拷贝
+		std::optional<ElementType> Element_Search(const ElementType &element) const
+		{
+			auto guard = Reclamation::Epoch_Domain::Global().Pin();
+			Node *pred{};
+			for (int i = static_cast<int>(level.load(std::memory_order_acquire)); i >= 0; --i)
+			{
+				Node *curr = _Pointer((pred ? pred->next[i] : header[i]).load(std::memory_order_acquire));
+				while (curr)
+				{
+					uintptr_t succ = curr->next[i].load(std::memory_order_acquire);
+					if (_Is_Marked(succ)) // 跳过已删除的节点
+					{
+						curr = _Pointer(succ);
+						continue;
+					}
+					if (!(curr->element < element))
+						break;
+					pred = curr;
+					curr = _Pointer(succ);
+				}
+				if (curr && !(element < curr->element) && !_Is_Marked(curr->next[0].load(std::memory_order_acquire)))
+					return curr->element;
+			}
+			return std::nullopt;
+		}
+		bool Contains(const ElementType &element) const { return Element_Search(element).has_value(); }
+
+		/// @brief 插入元素，元素已存在时返回false
+		bool Try_Insert(const ElementType &element)
+		{
+			auto guard = Reclamation::Epoch_Domain::Global().Pin();
+			size_t level_target = _Determine_Level();
+			Search_Path preds, succs;
+			Node *node{};
+			while (true)
+			{
+				if (_Find(element, preds, succs))
+				{
+					if (node) // 还没有发布，其他线程不可见，直接释放
+						_Node_Destroy(node);
+					return false;
+				}
+				if (!node)
+					node = _Node_Create(element, level_target);
+				for (size_t i = 0; i <= level_target; ++i)
+					node->next[i].store(_Link(succs[i]), std::memory_order_relaxed);
+				uintptr_t expected = _Link(succs[0]);
+				if (_Next(preds[0], 0).compare_exchange_strong(expected, _Link(node), std::memory_order_release, std::memory_order_relaxed))
+					break; // 第0层链接成功，元素已插入
+			}
+			size.fetch_add(1, std::memory_order_relaxed);
+
+			// 自下而上链接较高的层。节点被删除(该层已标记)时停止
+			for (size_t i = 1; i <= level_target; ++i)
+			{
+				while (true)
+				{
+					uintptr_t link = node->next[i].load(std::memory_order_acquire);
+					if (_Is_Marked(link))
+						goto linked;
+					if (_Pointer(link) != succs[i] &&
+						!node->next[i].compare_exchange_strong(link, _Link(succs[i]), std::memory_order_acq_rel, std::memory_order_acquire))
+						continue; // 失败说明该层刚被标记
+					uintptr_t expected = _Link(succs[i]);
+					if (_Next(preds[i], i).compare_exchange_strong(expected, _Link(node), std::memory_order_release, std::memory_order_relaxed))
+						break;
+					_Find(element, preds, succs); // 前驱已改变，重新定位
+					if (succs[0] != node)		  // 节点已被删除
+						goto linked;
+				}
+			}
+		linked:
+			// 删除线程可能在某一层链接之前就完成了摘除，由插入线程再摘除一次
+			// 先链接较高的层再读第0层的标记，删除线程先标记第0层再读前驱的后继(_Find)：两边各写后读对方写的位置，
+			// acquire/release不能保证至少一方看到对方的修改，与Try_Delete中的栅栏配对
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (_Is_Marked(node->next[0].load(std::memory_order_acquire)))
+				_Find(element, preds, succs);
+			_Node_Release(node);
+			return true;
+		}
+
+		/// @brief 删除元素，元素不存在(或被其他线程抢先删除)时返回false
+		bool Try_Delete(const ElementType &element)
+		{
+			auto guard = Reclamation::Epoch_Domain::Global().Pin();
+			Search_Path preds, succs;
+			if (!_Find(element, preds, succs))
+				return false;
+			Node *node = succs[0];
+			for (size_t i = node->level; i > 0; --i) // 自上而下标记，之后该层的后继不能再修改
+				node->next[i].fetch_or(mark, std::memory_order_acq_rel);
+			if (_Is_Marked(node->next[0].fetch_or(mark, std::memory_order_acq_rel)))
+				return false; // 其他线程先标记了第0层
+			size.fetch_sub(1, std::memory_order_relaxed);
+			// 与Try_Insert中linked处的栅栏配对：插入线程看不到第0层的标记时，这里的_Find一定能看到它链接的所有层
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			_Find(element, preds, succs); // 从各层摘除
+			_Node_Release(node);
+			return true;
+		}
+
+		void Element_Insert(const ElementType &element)
+		{
+			if (!Try_Insert(element))
+				throw std::runtime_error("Key already exists");
+		}
+		void Element_Delete(const ElementType &element)
+		{
+			if (!Try_Delete(element))
+				throw std::runtime_error("No such element " + std::to_string(element));
+		}
+	};
+}
+
+template <typename ElementType = int, float probable = 0.5f, typename RandomSource = Random::Thread_Local<>>
+using Skip_List_Concurrent = Storage::Skip_List_Concurrent<ElementType, probable, RandomSource>;
+
+#if __cplusplus >= 202002L
+#include "../ADT.hpp"
+static_assert(ADT::Skip_List<Skip_List_Concurrent<int, 0.5f>, int>);
+#endif
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <bit>	   //countl_zero
+#include <cstdint> //uint64_t
+#include <limits>
+
+/// ============================================================================================================
+/// 跳表选择节点层数的随机数源，作为Skip_List的模板参数
+/// 随机数源是一个函数对象，每次调用返回一个64位均匀分布的随机数：
+/// 		uint64_t operator()()
+/// 		1. Xorshift64：xorshift64*生成器，状态只有8字节，可作为跳表成员使用指定的种子
+/// 		2. Thread_Local：每个线程一个生成器(默认)，没有共享状态，多线程插入不同的跳表时互不影响
+/// 层数由一个随机数直接得到：probable = 1/2^k 时，随机数每k位全为0的概率为probable，
+/// 前导零个数/k即为层数，不需要每层调用一次rand()
+/// ============================================================================================================
+
+namespace Random
+{
+	/// @brief splitmix64，把任意种子(包括0)扩散为生成器的初始状态
+	constexpr uint64_t Mix(uint64_t seed)
+	{
+		seed += 0x9E3779B97F4A7C15ull;
+		seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ull;
+		seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBull;
+		return seed ^ (seed >> 31);
+	}
+
+	/// @brief xorshift64*，周期2^64-1，高位的质量比低位好
+	/// @note 满足std::uniform_random_bit_generator，也可以用于标准库的分布
+	class Xorshift64
+	{
+	private:
+		uint64_t state;
+
+	public:
+		using result_type = uint64_t;
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+	public:
+		constexpr explicit Xorshift64(uint64_t seed = 0) : state{Mix(seed) | 1} {} // 状态不能为0
+		constexpr result_type operator()()
+		{
+			state ^= state >> 12;
+			state ^= state << 25;
+			state ^= state >> 27;
+			return state * 0x2545F4914F6CDD1Dull;
+		}
+	};
+
+	/// @brief 线程局部的随机数源：每个线程第一次使用时按创建顺序取一个种子
+	/// @note 单线程程序中默认的序列是确定的；Seed只重置调用线程的生成器
+	template <typename Generator = Xorshift64>
+	struct Thread_Local
+	{
+		static Generator &Get()
+		{
+			static std::atomic<uint64_t> thread_count{};
+			thread_local Generator generator{thread_count.fetch_add(1, std::memory_order_relaxed)};
+			return generator;
+		}
+		static void Seed(uint64_t seed) { Get() = Generator{seed}; }
+		uint64_t operator()() const { return Get()(); }
+	};
+
+	/// @brief 从一个随机数得到节点层数：每升一层的概率为probable，结果不超过limit
+	/// probable = 1/2^k 时取前导零个数/k，其余概率逐层比较随机数与阈值
+	template <float probable, typename Source>
+	size_t Level(Source &source, size_t limit)
+	{
+		constexpr int shift = [] // probable == 1/2^shift时为shift，否则为0
+		{
+			for (int k = 1; k < 64; ++k)
+				if (static_cast<double>(probable) * static_cast<double>(1ull << k) == 1.0)
+					return k;
+			return 0;
+		}();
+		size_t level{};
+		if constexpr (shift != 0)
+			level = static_cast<size_t>(std::countl_zero(static_cast<uint64_t>(source()) | 1) / shift);
+		else
+		{
+			constexpr auto threshold = static_cast<uint64_t>(static_cast<double>(probable) * 0x1p64);
+			while (level < limit && static_cast<uint64_t>(source()) < threshold)
+				++level;
+		}
+		return level < limit ? level : limit;
+	}
+}
@@ -2,8 +2,49 @@
 
 // #include "Object.h"
 #include "../Linear_List.hpp"
+#include "../../../Uninitialized_Array.hpp"
+#include "Sequential_Search.hpp"
+#include <algorithm>
 #include <iostream>
 #include <cstring> //memcpy
+#include <memory> //construct_at,allocator
+#include <type_traits>
+#include <iterator>
+#include <span>
+
+namespace Policy
+{
+	/// @brief 顺序表的几何增长策略
+	/// @tparam factor 扩展倍数，空间不足时 capcity *= factor
+	/// @tparam shrink_threshold 元素个数 <= capcity * shrink_threshold 时收缩为 capcity / factor。为0时不自动收缩
+	/// @note 倍数增长使n次尾插的总搬运次数 <= n * factor / (factor - 1)，即均摊O(1)
+	/// @note shrink_threshold取1/factor时，在容量边界反复插入删除会反复扩展收缩，取更小的值(如1/4)可以避免
+	template <float factor = 2.0f, float shrink_threshold = 1.0f / factor>
+	struct Growth_Geometric
+	{
+		static_assert(factor > 1.0f, "Growth factor must be greater than 1");
+		static_assert(shrink_threshold >= 0.0f && shrink_threshold < 1.0f, "Shrink threshold must be in [0, 1)");
+
+		/// @brief 返回能容纳required个元素的新容量
+		static size_t Expand(size_t capcity, size_t required)
+		{
+			size_t expand = static_cast<size_t>(capcity * factor);
+			if (expand <= capcity) // capcity过小时(如1*1.5)取整后不增长
+				expand = capcity + 1;
+			return expand < required ? required : expand;
+		}
+		/// @brief 删除元素后的新容量，不需要收缩时返回原容量
+		static size_t Shrink(size_t capcity, size_t size)
+		{
+			if constexpr (shrink_threshold == 0.0f)
+				return capcity;
+			size_t shrink = static_cast<size_t>(capcity / factor);
+			if (shrink < 1 || shrink < size || size > capcity * shrink_threshold)
+				return capcity;
+			return shrink;
+		}
+	};
+}
 
 namespace Storage
 {
@@ -29,40 +70,66 @@ namespace Storage
 			return --pos;
 		}
 
-	public: /// 操作
-		void _Destroy_NonPointerElements()
-		{ // 栈上的元素不要手动调用析构函数，退栈时系统会自动调用
-			std::cout << "_Destroy_NonPointerElements" << std::endl;
-			for (size_t i = 0; i < this->size; i++)
-				this->storage[i] = ElementType();
-		}
-		void _Destroy_PointerElements()
+		/// @brief 把source开始的count个元素搬到未初始化的destination，搬运后source的空间视为未初始化
+		/// @note 可平凡复制的类型直接memcpy，否则逐个移动构造并析构原元素
+		static void _Relocate(ElementType *destination, ElementType *source, size_t count)
 		{
-			std::cout << "_Destroy_PointerElements" << std::endl;
-			// static_assert(std::is_pointer<ElementType>::value);
-			for (size_t i = 0; i < this->size; i++)
-			{
-				this->storage[i].~ElementType();
+			if (count == 0)
+				return;
+			if constexpr (std::is_trivially_copyable_v<ElementType>)
+				std::memcpy(static_cast<void *>(destination), static_cast<const void *>(source), count * sizeof(ElementType));
+			else
+				for (size_t i = 0; i < count; i++)
+				{
+					std::construct_at(destination + i, std::move(source[i]));
+					std::destroy_at(source + i);
+				}
+		}
 
-				// if (!std::is_array<ElementType>::value)
-				// 	delete this->storage[i];
-				// else
-				// 	delete[] this->storage[i];
-				this->storage[i] = ElementType();
-			}
+		/// @brief 把[index,size)的元素整体后移count个位置，空出[index,index+count)作为未初始化的空间
+		/// @note 调用前需确保容量足够。可平凡复制的类型一次memmove，否则从后往前逐个搬运
+		void _Open_Gap(size_t index, size_t count)
+		{
+			if (count == 0 || index == this->size)
+				return;
+			if constexpr (std::is_trivially_copyable_v<ElementType>)
+				std::memmove(static_cast<void *>(storage + index + count), static_cast<const void *>(storage + index),
+							 (this->size - index) * sizeof(ElementType));
+			else
+				for (size_t i = this->size; i > index; i--)
+				{
+					std::construct_at(storage + i - 1 + count, std::move(storage[i - 1]));
+					std::destroy_at(storage + i - 1);
+				}
+		}
+		/// @brief _Open_Gap的逆操作，[index,index+count)的元素已析构，把[index+count,size)整体前移count个位置
+		void _Close_Gap(size_t index, size_t count)
+		{
+			if (count == 0 || index + count == this->size)
+				return;
+			if constexpr (std::is_trivially_copyable_v<ElementType>)
+				std::memmove(static_cast<void *>(storage + index), static_cast<const void *>(storage + index + count),
+							 (this->size - index - count) * sizeof(ElementType));
+			else
+				for (size_t i = index + count; i < this->size; i++)
+				{
+					std::construct_at(storage + i - count, std::move(storage[i]));
+					std::destroy_at(storage + i);
+				}
 		}
+
+		/// @brief 确保能容纳required个元素，不足时由派生类扩展空间或抛出异常
+		virtual void _Ensure_Capcity(size_t required) = 0;
+		/// @brief 删除元素后调用，派生类可以在此收缩空间
+		virtual void _Shrink() {}
+
+	public: /// 操作
+		// 析构所有元素，保留存储空间
 		void List_Clear() override
 		{
 			if (!this->storage)
 				throw std::runtime_error("List is not exist");
-
-			// 如果存指针的话要delete的操作
-			if (std::is_pointer<ElementType>::value == std::true_type())
-				// _Destroy_PointerElements();
-				std::cout << "Clear pointer Element Not Implemented yet" << std::endl;
-			else
-				_Destroy_NonPointerElements();
-
+			std::destroy_n(this->storage, this->size);
 			this->size = 0;
 		}
 		// 返回当前最大容量
@@ -75,12 +142,97 @@ namespace Storage
 			return this->storage[Index(pos)];
 		}
 
+	public: /// 查找
+		/// @brief 返回第一个等于element的元素的位序，不存在时返回0
+		/// @note 算术类型使用SIMD内核，见Sequential_Search.hpp
+		size_t Find(const ElementType &element) const
+		{
+			size_t index = Search::Find(storage, this->size, element);
+			return index == this->size ? 0 : index + 1;
+		}
+		// 返回等于element的元素个数
+		size_t Count(const ElementType &element) const { return Search::Count(storage, this->size, element); }
+		// 判断是否存在等于element的元素
+		bool Contains(const ElementType &element) const { return Find(element) != 0; }
+
 	public: /// 元素操作
 		// 插入元素
-		virtual void Element_Insert(size_t pos, const ElementType &elem) = 0;
-		virtual void Element_Insert(size_t pos, ElementType &&elem) = 0;
+		void Element_Insert(size_t pos, const ElementType &elem) override
+		{ /// 先拷贝一份，防止elem引用的是表内元素，扩展空间或搬运元素后失效
+			Element_Insert(pos, ElementType(elem));
+		}
+		void Element_Insert(size_t pos, ElementType &&elem) override
+		{ /// n个元素有n+1个可插入位置,存储空间不足时由派生类处理，位置pos非法时候抛出异常并终止插入元素
+			if (pos < 1 || pos > this->size + 1)
+				throw std::out_of_range("List insert failed: Position out of range");
+			_Ensure_Capcity(this->size + 1);
+
+			size_t index = Index(pos);
+			_Open_Gap(index, 1);
+			try
+			{
+				std::construct_at(storage + index, std::move(elem));
+			}
+			catch (...)
+			{
+				_Close_Gap(index, 1);
+				throw;
+			}
+			++this->size;
+		}
+		/// @brief 在第pos个位置插入[first,last)的所有元素，原有元素只整体后移一次
+		/// @note [first,last)不能来自当前线性表，扩展空间后会失效
+		template <std::forward_iterator Iterator>
+		void Element_Insert(size_t pos, Iterator first, Iterator last)
+		{
+			if (pos < 1 || pos > this->size + 1)
+				throw std::out_of_range("List insert failed: Position out of range");
+			size_t count = static_cast<size_t>(std::distance(first, last));
+			if (count == 0)
+				return;
+			_Ensure_Capcity(this->size + count);
+
+			size_t index = Index(pos);
+			_Open_Gap(index, count);
+			try
+			{
+				std::uninitialized_copy(first, last, storage + index);
+			}
+			catch (...)
+			{
+				_Close_Gap(index, count);
+				throw;
+			}
+			this->size += count;
+		}
+		void Element_Insert(size_t pos, std::span<const ElementType> elements)
+		{
+			Element_Insert(pos, elements.begin(), elements.end());
+		}
+		void Element_Insert(size_t pos, std::initializer_list<ElementType> elements)
+		{
+			Element_Insert(pos, elements.begin(), elements.end());
+		}
+
 		// 删除元素
-		virtual void Element_Delete(size_t pos) = 0;
+		void Element_Delete(size_t pos) override
+		{
+			Element_Delete(pos, 1);
+		}
+		/// @brief 删除从第pos个位置开始的count个元素，后续元素只整体前移一次
+		void Element_Delete(size_t pos, size_t count)
+		{
+			size_t index = Index(pos); // check pos valid
+			if (count > this->size || index > this->size - count)
+				throw std::out_of_range("List delete failed: Position out of range");
+			if (count == 0)
+				return;
+
+			std::destroy_n(storage + index, count);
+			_Close_Gap(index, count);
+			this->size -= count;
+			_Shrink();
+		}
 		// 修改顺序表List第pos个位置上的元素为elem
 		void Element_Update(size_t pos, ElementType&& elem) override
 		{
@@ -96,46 +248,54 @@ namespace Storage
 					  << "[Size/Capcity]:\n"
 					  << " [" << this->size << '/' << capcity << ']' << std::endl
 					  << "storage->";
-			for (size_t index = 0; index < capcity; index++)
+			for (size_t index = 0; index < this->size; index++)
 				std::cout << '[' << index << ':' << this->storage[index] << "]-";
+			for (size_t index = this->size; index < capcity; index++) // 空闲位置没有构造元素，不访问
+				std::cout << '[' << index << ":]-";
 			std::cout << "End\n";
 		}
 	};
 };
 
 /// 静态数组
+/// @note 栈上申请未初始化的空间，只有[0,size)的元素是构造过的，元素类型不需要默认构造
 template <typename ElementType, size_t capcity>
 class Sequential_List_Static : public Storage::Sequential_List<ElementType>
 {
-	ElementType array[capcity]{}; // 栈上申请空间
+	Uninitialized_Array<ElementType, capcity> array; // 栈上申请空间
+
+protected:
+	void _Ensure_Capcity(size_t required) override
+	{
+		if (required > this->capcity)
+			throw std::runtime_error("List insert failed: List is full");
+	}
+
 public:
 	Sequential_List_Static()
-		: Storage::Sequential_List<ElementType>(0, array, capcity)
+		: Storage::Sequential_List<ElementType>(0, array.Data(), capcity)
 	{
 		static_assert(capcity > 0, "Capacity must be greater than 0");
-		// this->storage = array;
-		// this->capcity = capcity;
 	}
 	Sequential_List_Static(const Sequential_List_Static<ElementType,capcity> &other)
-		: Storage::Sequential_List<ElementType>(0, array, capcity)
+		: Storage::Sequential_List<ElementType>(0, array.Data(), capcity)
 	{
-		for (size_t i = 0; i < capcity; i++)
-			array[i] = other.array[i];
+		std::uninitialized_copy_n(other.storage, other.size, this->storage);
 		this->size = other.size;
 	}
 	Sequential_List_Static<ElementType, capcity>& operator=(const Sequential_List_Static<ElementType, capcity> &other)
 	{
+		if (this == &other)
+			return *this;
 		this->List_Clear();
-		for (size_t i = 0; i < capcity; i++)
-			array[i] = other.array[i];
+		std::uninitialized_copy_n(other.storage, other.size, this->storage);
 		this->size = other.size;
 		return *this;
 	}
 	Sequential_List_Static(Sequential_List_Static<ElementType, capcity> &&other)
-		: Storage::Sequential_List<ElementType>(0, array, capcity)
+		: Storage::Sequential_List<ElementType>(0, array.Data(), capcity)
 	{
-		for (size_t i = 0; i < capcity; i++)
-			array[i] = std::move(other.array[i]);
+		std::uninitialized_move_n(other.storage, other.size, this->storage);
 		this->size = other.size;
 		other.List_Clear();
 		other.capcity = 0;//由于被移动的对象不应该再次被访问，所以保险起见重置
@@ -143,109 +303,85 @@ public:
 	Sequential_List_Static<ElementType, capcity> &
 	operator=(Sequential_List_Static<ElementType, capcity> &&other)
 	{
+		if (this == &other)
+			return *this;
 		this->List_Clear();
-		for (size_t i = 0; i < capcity; i++)
-			array[i] = std::move(other.array[i]);
+		std::uninitialized_move_n(other.storage, other.size, this->storage);
 		this->size = other.size;
 		other.List_Clear();
 		other.capcity = 0;
 		return *this;
 	}
 	Sequential_List_Static(std::initializer_list<ElementType> list)
-		: Storage::Sequential_List<ElementType>(list.size(), array, capcity)
+		: Storage::Sequential_List<ElementType>(0, array.Data(), capcity)
 	{
 		if (list.size() > capcity)
 			throw std::runtime_error("initializer_list Constructed Failed: no enough capcity");
-		// this->storage = array;
-		// this->capcity = capcity;
-		// for (size_t i = 0; i < list.size(); i++)
-		// 	this->storage[i] = std::move(list[i]);
-		size_t i{};
-		for (const auto &element : list)
-			this->storage[i++] = element;
-	}
-
-public:
-	void Element_Insert(size_t pos, const ElementType &elem) override
-	{ /// n个元素有n+1个可插入位置,存储空间不足时不扩展并报错，位置pos非法时候抛出异常并终止插入元素
-		if (pos < 1 || pos > this->size + 1)
-			throw std::out_of_range("List insert failed: Position out of range");
-		if (this->size >= this->capcity)
-			throw std::runtime_error("List insert failed: List is full");
-
-		if (this->size == 0)
-			this->storage[0] = elem;
-		else
-		{ /// 从后往前，把当前索引向后搬
-			int count = this->size - pos;// size_t patch
-			for (int index = this->Index(this->size); count >= 0;--count,--index)
-				this->storage[index + 1] = this->storage[index];
-			this->storage[this->Index(pos)] = elem;
-		}
-		++this->size;
+		std::uninitialized_copy(list.begin(), list.end(), this->storage);
+		this->size = list.size();
 	}
-	void Element_Insert(size_t pos, ElementType &&elem) override
-	{ /// n个元素有n+1个可插入位置,存储空间不足时不扩展并报错，位置pos非法时候抛出异常并终止插入元素
-		if (pos < 1 || pos > this->size + 1)
-			throw std::out_of_range("List insert failed: Position out of range");
-		if (this->size >= this->capcity)
-			throw std::runtime_error("List insert failed: List is full");
-
-		if (this->size == 0)
-			this->storage[0] = elem;
-		else
-		{ /// 从后往前，把当前索引向后搬
-			int count = this->size - pos;// size_t patch
-			for (int index = this->Index(this->size); count >= 0; --count, --index)
-				this->storage[index + 1] = this->storage[index];
-			this->storage[this->Index(pos)] = elem;
-		}
-		++this->size;
-	}
-	void Element_Delete(size_t pos) override
+	~Sequential_List_Static()
 	{
-		this->Index(pos); // Check pos is valid
-		for (int i = this->Index(pos); i <= static_cast<int>(this->Index(this->size)) - 1; i++)// size_t patch
-			this->storage[i] = this->storage[i + 1];
-		this->storage[this->size - 1] = ElementType{}; /// 末尾补0
-		--this->size;
+		std::destroy_n(this->storage, this->size);
 	}
 };
 
 /// 动态数组
-template <typename ElementType>
+/// @tparam GrowthPolicy 容量的扩展收缩策略，默认2倍扩展、元素个数<=1/2容量时收缩
+/// @note 只有[0,size)的元素是构造过的，[size,capcity)是未初始化的内存，所以元素类型不需要默认构造
+template <typename ElementType, typename GrowthPolicy = Policy::Growth_Geometric<>>
 class Sequential_List_Dynamic : public Storage::Sequential_List<ElementType>
 {
+	using Allocator = std::allocator<ElementType>;
+
 public:
 	// Sequential_List_Dynamic()
 	// 	: Storage::Sequential_List<ElementType>(){};
 	Sequential_List_Dynamic(size_t capcity = 5)
-		: Storage::Sequential_List<ElementType>(0, new ElementType[capcity]{}, capcity)
+		: Storage::Sequential_List<ElementType>(0, nullptr, capcity)
 	{ // capcity必须>0
 		if (capcity < 1)
 			throw std::invalid_argument("List Init Failed: capcity must be greater than 1");
-		if (!this->storage)
-			throw std::bad_alloc();
+		this->storage = Allocator{}.allocate(capcity); // 失败时抛出std::bad_alloc
 	}
 
 	Sequential_List_Dynamic(const Sequential_List_Dynamic &other)
-		: Storage::Sequential_List<ElementType>(other.size, new ElementType[other.capcity]{}, other.capcity)
+		: Storage::Sequential_List<ElementType>(0, nullptr, other.capcity)
 	{
 		if (this == &other)
 			throw std::invalid_argument("Self copy is invalid");
 
-		for (size_t i = 0; i < other.size; i++)
-			this->storage[i] = other.storage[i];
+		this->storage = Allocator{}.allocate(other.capcity);
+		try
+		{
+			std::uninitialized_copy_n(other.storage, other.size, this->storage);
+		}
+		catch (...) // 构造函数抛出时不调用析构函数，释放已申请的空间
+		{
+			Allocator{}.deallocate(this->storage, other.capcity);
+			throw;
+		}
+		this->size = other.size;
 	}
 	Sequential_List_Dynamic &operator=(const Sequential_List_Dynamic &other)
 	{
 		if (this == &other)
 			throw std::invalid_argument("Self copy is invalid");
+		ElementType *storage = Allocator{}.allocate(other.capcity);
+		try
+		{
+			std::uninitialized_copy_n(other.storage, other.size, storage);
+		}
+		catch (...) // 拷贝失败时保持原表不变
+		{
+			Allocator{}.deallocate(storage, other.capcity);
+			throw;
+		}
+
+		_Release();
 		this->size = other.size;
 		this->capcity = other.capcity;
-		this->storage = new ElementType[this->capcity]{};
-		for (size_t i = 0; i < other.size; i++)
-			this->storage[i] = other.storage[i];
+		this->storage = storage;
 		return *this;
 	}
 
@@ -258,6 +394,9 @@ public:
 	}
 	Sequential_List_Dynamic &operator=(Sequential_List_Dynamic &&other)
 	{
+		if (this == &other)
+			return *this;
+		_Release();
 		this->size    = other.size;
 		this->capcity = other.capcity;
 		this->storage = other.storage;
@@ -267,102 +406,215 @@ public:
 		return *this;
 	}
 
-	//初始化列表构造时，默认分配1.5倍size空间
+	//初始化列表构造时，默认分配1.5倍size空间，空列表也至少分配1个
 	Sequential_List_Dynamic(std::initializer_list<ElementType> list)
-		: Storage::Sequential_List<ElementType>(list.size(), nullptr, list.size() * 1.5)
+		: Storage::Sequential_List<ElementType>(0, nullptr, std::max<size_t>(list.size() * 1.5, 1))
 	{
-		this->storage = new ElementType[static_cast<size_t>(list.size() * 1.5)];
-		size_t i{};
-		for (const auto &element : list)
-			this->storage[i++] = element;
+		this->storage = Allocator{}.allocate(this->capcity);
+		try
+		{
+			std::uninitialized_copy(list.begin(), list.end(), this->storage);
+		}
+		catch (...) // 构造函数抛出时不调用析构函数，释放已申请的空间
+		{
+			Allocator{}.deallocate(this->storage, this->capcity);
+			throw;
+		}
+		this->size = list.size();
 	}
 	~Sequential_List_Dynamic()
 	{
-		if (this->storage)
-		{
-			delete[] this->storage;
-			this->storage = nullptr;
-			this->size = 0;
-		}
+		_Release();
 	}
 
 protected:
-	// 以2倍为单位扩展收缩空间
-	void Expand()
-	{ /// 重新申请2倍的空间，移动原有数据至该空间
+	// 析构所有元素并释放存储空间
+	void _Release()
+	{
 		if (!this->storage)
-			throw std::runtime_error("storage space missing");
-		auto expand = new ElementType[this->capcity * 2]{};
-		// 把所有元素移动过去
-		for (size_t i = 0; i < this->size; i++)
-			expand[i] = std::move(this->storage[i]);
+			return;
+		std::destroy_n(this->storage, this->size);
+		Allocator{}.deallocate(this->storage, this->capcity);
+		this->storage = nullptr;
+		this->size = 0;
+	}
+	/// @brief 重新申请capcity个元素的空间，把所有元素搬运至该空间
+	void _Reallocate(size_t capcity)
+	{
+		ElementType *storage = Allocator{}.allocate(capcity);
+		this->_Relocate(storage, this->storage, this->size);
+		if (this->storage)
+			Allocator{}.deallocate(this->storage, this->capcity);
+		this->storage = storage;
+		this->capcity = capcity;
+	}
+	// 按GrowthPolicy扩展收缩空间
+	void _Ensure_Capcity(size_t required) override
+	{
+		if (required > this->capcity)
+			_Reallocate(GrowthPolicy::Expand(this->capcity, required));
+	}
+	void _Shrink() override
+	{
+		size_t capcity = GrowthPolicy::Shrink(this->capcity, this->size);
+		if (capcity < this->capcity)
+			_Reallocate(capcity);
+	}
 
-		delete[] this->storage;
-		this->storage = expand;
-		this->capcity *= 2;
+public: /// 表操作
+	/// @brief 预留至少capcity个元素的空间，之后插入到capcity个元素前不会再申请空间
+	void Reserve(size_t capcity)
+	{
+		if (capcity > this->capcity)
+			_Reallocate(capcity);
 	}
-	void Shrink()
+	/// @brief 释放多余的空间，使容量等于元素个数(至少保留1个元素空间)
+	void Shrink_To_Fit()
 	{
-		if (!this->storage)
-			throw std::runtime_error("storage space missing");
-
-		auto shrink = new ElementType[this->capcity / 2]{};
-		// 把所有元素移动过去
-		for (size_t i = 0; i < this->size; i++)
-			shrink[i] = std::move(this->storage[i]);
-		delete[] this->storage;
-		this->storage = shrink;
-		this->capcity /= 2;
-	}
-
-public: /// 元素操作
-	void Element_Insert(size_t pos, const ElementType &elem) override
-	{ /// n个元素有n+1个可插入位置,存储空间不足时扩展为两倍，位置pos非法时候抛出异常并终止插入元素
-		if (pos <= 0 || pos > this->size + 1)
-			throw std::out_of_range("List insert failed: Position out of range");
-
-		if (this->size >= this->capcity)
-			Expand(); /// 空间扩展为2倍
-		// this->List_Show(" ");
-		if (this->size == 0)
-			this->storage[0] = elem;
-		else
-		{ /// 从后往前，把当前索引向后搬
-			for (size_t index = this->Index(this->size); this->Index(pos) < index; index--)
-				this->storage[index + 1] = this->storage[index];
-			this->storage[this->Index(pos)] = elem;
+		size_t capcity = this->size > 1 ? this->size : 1;
+		if (this->storage && capcity < this->capcity)
+			_Reallocate(capcity);
+	}
+};
+
+/// 小缓冲区优化的动态数组
+/// @tparam inline_capcity 对象内部的缓冲区能容纳的元素个数，元素不超过该数量时不申请堆空间
+/// @tparam GrowthPolicy 超出缓冲区后堆空间的扩展收缩策略，收缩到不超过inline_capcity时搬回内部缓冲区
+/// @note 移动时堆空间直接转移指针；内部缓冲区的元素只能逐个移动，但最多inline_capcity个
+template <typename ElementType, size_t inline_capcity, typename GrowthPolicy = Policy::Growth_Geometric<>>
+class Sequential_List_Small : public Storage::Sequential_List<ElementType>
+{
+	using Allocator = std::allocator<ElementType>;
+
+	Uninitialized_Array<ElementType, inline_capcity> buffer; // 内部缓冲区
+
+public:
+	Sequential_List_Small()
+		: Storage::Sequential_List<ElementType>(0, buffer.Data(), inline_capcity) {}
+	Sequential_List_Small(const Sequential_List_Small &other)
+		: Sequential_List_Small()
+	{
+		_Copy_Elements(other);
+	}
+	Sequential_List_Small &operator=(const Sequential_List_Small &other)
+	{
+		if (this == &other)
+			return *this;
+		_Release();
+		_Copy_Elements(other);
+		return *this;
+	}
+	Sequential_List_Small(Sequential_List_Small &&other)
+		: Sequential_List_Small()
+	{
+		_Move_Elements(other);
+	}
+	Sequential_List_Small &operator=(Sequential_List_Small &&other)
+	{
+		if (this == &other)
+			return *this;
+		_Release();
+		_Move_Elements(other);
+		return *this;
+	}
+	Sequential_List_Small(std::initializer_list<ElementType> list)
+		: Sequential_List_Small()
+	{
+		this->Element_Insert(1, list);
+	}
+	~Sequential_List_Small()
+	{
+		_Release();
+	}
+
+protected:
+	bool _Is_Inline() const { return this->storage == buffer.Data(); }
+	// 析构所有元素，释放堆空间并回到内部缓冲区
+	void _Release()
+	{
+		std::destroy_n(this->storage, this->size);
+		if (!_Is_Inline())
+			Allocator{}.deallocate(this->storage, this->capcity);
+		this->storage = buffer.Data();
+		this->capcity = inline_capcity;
+		this->size = 0;
+	}
+	// 调用前当前表为空且位于内部缓冲区。元素放得下时拷贝到内部缓冲区，否则申请刚好够用的堆空间
+	void _Copy_Elements(const Sequential_List_Small &other)
+	{
+		if (other.size > inline_capcity)
+		{
+			this->storage = Allocator{}.allocate(other.size);
+			this->capcity = other.size;
+		}
+		try
+		{
+			std::uninitialized_copy_n(other.storage, other.size, this->storage);
 		}
-		++this->size;
-	}
-	void Element_Insert(size_t pos, ElementType &&elem) override
-	{ /// n个元素有n+1个可插入位置,存储空间不足时扩展为两倍，位置pos非法时候抛出异常并终止插入元素
-		if (pos <= 0 || pos > this->size + 1)
-			throw std::out_of_range("List insert failed: Position out of range");
-
-		if (this->size >= this->capcity)
-			Expand(); /// 空间扩展为2倍
-		// this->List_Show(" ");
-		if (this->size == 0)
-			this->storage[0] = std::move(elem);
-		else
-		{ /// 从后往前，把当前索引向后搬
-			for (size_t index = this->Index(this->size); this->Index(pos) < index; index--)
-				this->storage[index + 1] = this->storage[index];
-			this->storage[this->Index(pos)] = std::move(elem);
+		catch (...)
+		{
+			_Release();
+			throw;
+		}
+		this->size = other.size;
+	}
+	// 调用前当前表为空且位于内部缓冲区。other使用堆空间时直接接管，否则逐个搬运元素
+	void _Move_Elements(Sequential_List_Small &other)
+	{
+		if (other._Is_Inline())
+		{
+			this->_Relocate(this->storage, other.storage, other.size);
+			this->size = other.size;
+			other.size = 0;
+			return;
 		}
-		++this->size;
+		this->storage = other.storage;
+		this->capcity = other.capcity;
+		this->size = other.size;
+		other.storage = other.buffer.Data();
+		other.capcity = inline_capcity;
+		other.size = 0;
+	}
+	/// @brief 把所有元素搬运到能容纳capcity个元素的空间，不超过inline_capcity时搬回内部缓冲区
+	void _Reallocate(size_t capcity)
+	{
+		ElementType *storage = capcity <= inline_capcity ? buffer.Data() : Allocator{}.allocate(capcity);
+		if (storage == this->storage)
+			return;
+		this->_Relocate(storage, this->storage, this->size);
+		if (!_Is_Inline())
+			Allocator{}.deallocate(this->storage, this->capcity);
+		this->storage = storage;
+		this->capcity = capcity <= inline_capcity ? inline_capcity : capcity;
+	}
+	void _Ensure_Capcity(size_t required) override
+	{
+		if (required > this->capcity)
+			_Reallocate(GrowthPolicy::Expand(this->capcity, required));
+	}
+	void _Shrink() override
+	{
+		if (_Is_Inline())
+			return;
+		size_t capcity = GrowthPolicy::Shrink(this->capcity, this->size);
+		if (capcity < this->capcity)
+			_Reallocate(capcity);
+	}
+
+public: /// 表操作
+	// 元素是否存放在内部缓冲区(没有申请堆空间)
+	bool Is_Inline() const { return _Is_Inline(); }
+	/// @brief 预留至少capcity个元素的空间
+	void Reserve(size_t capcity)
+	{
+		if (capcity > this->capcity)
+			_Reallocate(capcity);
 	}
-	void Element_Delete(size_t pos)
+	/// @brief 释放多余的堆空间，元素不超过inline_capcity时搬回内部缓冲区
+	void Shrink_To_Fit()
 	{
-		this->Index(pos); // check pos valid
-		for (size_t i = this->Index(pos); i <= this->Index(this->size) - 1; i++)
-			// this->storage[i] = this->storage[i + 1];
-			this->storage[i] = std::move(this->storage[i + 1]);
-		this->storage[this->size - 1] = ElementType{};
-		--this->size;
-		/// 元素个数<=1/2最大容量 时收缩空间
-		if (this->size <= this->capcity / 2)
-			Shrink();
+		if (!_Is_Inline() && this->size < this->capcity)
+			_Reallocate(this->size);
 	}
 };
 
@@ -370,4 +622,6 @@ public: /// 元素操作
 #include "../ADT.hpp"
 static_assert(ADT::Linear_List<Sequential_List_Static<int, 5>, int>);
 static_assert(ADT::Linear_List<Sequential_List_Dynamic<int>, int>);
+static_assert(ADT::Linear_List<Sequential_List_Dynamic<int, Policy::Growth_Geometric<1.5f>>, int>);
+static_assert(ADT::Linear_List<Sequential_List_Small<int, 16>, int>);
 #endif
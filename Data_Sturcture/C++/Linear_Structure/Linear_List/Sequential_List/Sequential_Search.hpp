@@ -0,0 +1,273 @@
+#pragma once
+
+#include <bit>	   //countr_zero
+#include <cstddef>
+#include <cstring> //memcpy
+#include <type_traits>
+
+/// ============================================================================================================
+/// 顺序存储的查找与计数内核：Find返回第一个等于element的下标(不存在时返回size)，Count返回等于element的个数
+/// 		1. 算术类型在x86上使用SIMD：SSE2是x86-64的基线指令集直接使用，AVX2在运行时检测CPU后选用
+/// 		2. 其他平台、其他类型使用标量循环
+/// 比较语义与operator==一致：浮点数NaN不等于任何值，+0.0等于-0.0
+/// SIMD的实现方式：一次比较一个向量的元素，相等的通道为全1(即整数-1)
+/// 		Find：比较结果用movemask压缩为按字节的位掩码，第一个置位的位置/sizeof(ElementType)即元素下标
+/// 		Count：每个通道用同宽度的整数计数器减去比较结果，计数器将要溢出前再水平求和，循环内没有popcount
+/// ============================================================================================================
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define SEQUENTIAL_SEARCH_SIMD
+#include <immintrin.h>
+#endif
+
+namespace Search
+{
+	/// @brief 可以使用SIMD内核的元素类型：1/2/4/8字节的整数、float和double
+	template <typename ElementType>
+	concept Vectorizable = std::is_arithmetic_v<ElementType> &&
+						   (sizeof(ElementType) == 1 || sizeof(ElementType) == 2 || sizeof(ElementType) == 4 || sizeof(ElementType) == 8);
+
+	template <typename ElementType>
+	size_t Find_Scalar(const ElementType *data, size_t size, const ElementType &element)
+	{
+		for (size_t index = 0; index < size; index++)
+			if (data[index] == element)
+				return index;
+		return size;
+	}
+	// 与ElementType同宽度的无符号整数，作为SIMD计数器的通道类型
+	template <typename ElementType>
+	using Lane = std::conditional_t<sizeof(ElementType) == 1, unsigned char,
+									std::conditional_t<sizeof(ElementType) == 2, unsigned short,
+													   std::conditional_t<sizeof(ElementType) == 4, unsigned int, unsigned long long>>>;
+	// 每个通道的计数器最多累加的次数，超过后需要水平求和并清零
+	template <typename ElementType>
+	constexpr size_t lane_limit = sizeof(ElementType) >= 4 ? size_t{1} << 30 : Lane<ElementType>(-1);
+
+	template <typename ElementType>
+	size_t Count_Scalar(const ElementType *data, size_t size, const ElementType &element)
+	{
+		size_t count{};
+		for (size_t index = 0; index < size; index++)
+			count += data[index] == element;
+		return count;
+	}
+
+#ifdef SEQUENTIAL_SEARCH_SIMD
+	/// ——————————————————————————————————————————————————
+	///  SSE2: 128位，一次比较16/sizeof(ElementType)个元素
+	/// ——————————————————————————————————————————————————
+	template <Vectorizable ElementType>
+	inline __m128i _Broadcast_SSE2(ElementType element)
+	{
+		if constexpr (std::is_same_v<ElementType, float>)
+			return _mm_castps_si128(_mm_set1_ps(element));
+		else if constexpr (std::is_same_v<ElementType, double>)
+			return _mm_castpd_si128(_mm_set1_pd(element));
+		else if constexpr (sizeof(ElementType) == 1)
+			return _mm_set1_epi8(static_cast<char>(element));
+		else if constexpr (sizeof(ElementType) == 2)
+			return _mm_set1_epi16(static_cast<short>(element));
+		else if constexpr (sizeof(ElementType) == 4)
+			return _mm_set1_epi32(static_cast<int>(element));
+		else
+		{
+			long long bits;
+			std::memcpy(&bits, &element, sizeof(bits));
+			return _mm_set1_epi64x(bits);
+		}
+	}
+	// 比较data开始的一个向量，相等的通道为全1
+	template <Vectorizable ElementType>
+	inline __m128i _Equal_SSE2(const ElementType *data, __m128i key)
+	{
+		__m128i vector = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data)), equal;
+		if constexpr (std::is_same_v<ElementType, float>)
+			equal = _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(vector), _mm_castsi128_ps(key)));
+		else if constexpr (std::is_same_v<ElementType, double>)
+			equal = _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(vector), _mm_castsi128_pd(key)));
+		else if constexpr (sizeof(ElementType) == 1)
+			equal = _mm_cmpeq_epi8(vector, key);
+		else if constexpr (sizeof(ElementType) == 2)
+			equal = _mm_cmpeq_epi16(vector, key);
+		else if constexpr (sizeof(ElementType) == 4)
+			equal = _mm_cmpeq_epi32(vector, key);
+		else
+		{ // SSE2没有64位整数比较：两个32位半字都相等才相等
+			equal = _mm_cmpeq_epi32(vector, key);
+			equal = _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+		}
+		return equal;
+	}
+	// 每个通道的计数器减去比较结果(相等时为-1)
+	template <Vectorizable ElementType>
+	inline __m128i _Lane_Subtract_SSE2(__m128i counter, __m128i equal)
+	{
+		if constexpr (sizeof(ElementType) == 1)
+			return _mm_sub_epi8(counter, equal);
+		else if constexpr (sizeof(ElementType) == 2)
+			return _mm_sub_epi16(counter, equal);
+		else if constexpr (sizeof(ElementType) == 4)
+			return _mm_sub_epi32(counter, equal);
+		else
+			return _mm_sub_epi64(counter, equal);
+	}
+	template <Vectorizable ElementType>
+	inline size_t _Lane_Sum_SSE2(__m128i counter)
+	{
+		Lane<ElementType> lanes[16 / sizeof(ElementType)];
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), counter);
+		size_t sum{};
+		for (auto lane : lanes)
+			sum += lane;
+		return sum;
+	}
+	template <Vectorizable ElementType>
+	size_t Find_SSE2(const ElementType *data, size_t size, const ElementType &element)
+	{
+		constexpr size_t step = 16 / sizeof(ElementType);
+		__m128i key = _Broadcast_SSE2(element);
+		size_t index = 0;
+		for (; index + step <= size; index += step)
+			if (unsigned mask = _mm_movemask_epi8(_Equal_SSE2(data + index, key)))
+				return index + std::countr_zero(mask) / sizeof(ElementType);
+		return index + Find_Scalar(data + index, size - index, element);
+	}
+	template <Vectorizable ElementType>
+	size_t Count_SSE2(const ElementType *data, size_t size, const ElementType &element)
+	{
+		constexpr size_t step = 16 / sizeof(ElementType);
+		__m128i key = _Broadcast_SSE2(element);
+		size_t index = 0, count = 0;
+		while (index + step <= size)
+		{
+			__m128i counter = _mm_setzero_si128();
+			for (size_t times = 0; times < lane_limit<ElementType> && index + step <= size; times++, index += step)
+				counter = _Lane_Subtract_SSE2<ElementType>(counter, _Equal_SSE2(data + index, key));
+			count += _Lane_Sum_SSE2<ElementType>(counter);
+		}
+		return count + Count_Scalar(data + index, size - index, element);
+	}
+
+	/// ——————————————————————————————————————————————————
+	///  AVX2: 256位，一次比较32/sizeof(ElementType)个元素，只在运行时检测到CPU支持后调用
+	/// ——————————————————————————————————————————————————
+#define SEQUENTIAL_SEARCH_AVX2 __attribute__((target("avx2")))
+	template <Vectorizable ElementType>
+	SEQUENTIAL_SEARCH_AVX2 inline __m256i _Broadcast_AVX2(ElementType element)
+	{
+		if constexpr (std::is_same_v<ElementType, float>)
+			return _mm256_castps_si256(_mm256_set1_ps(element));
+		else if constexpr (std::is_same_v<ElementType, double>)
+			return _mm256_castpd_si256(_mm256_set1_pd(element));
+		else if constexpr (sizeof(ElementType) == 1)
+			return _mm256_set1_epi8(static_cast<char>(element));
+		else if constexpr (sizeof(ElementType) == 2)
+			return _mm256_set1_epi16(static_cast<short>(element));
+		else if constexpr (sizeof(ElementType) == 4)
+			return _mm256_set1_epi32(static_cast<int>(element));
+		else
+		{
+			long long bits;
+			std::memcpy(&bits, &element, sizeof(bits));
+			return _mm256_set1_epi64x(bits);
+		}
+	}
+	template <Vectorizable ElementType>
+	SEQUENTIAL_SEARCH_AVX2 inline __m256i _Equal_AVX2(const ElementType *data, __m256i key)
+	{
+		__m256i vector = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data)), equal;
+		if constexpr (std::is_same_v<ElementType, float>)
+			equal = _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(vector), _mm256_castsi256_ps(key), _CMP_EQ_OQ));
+		else if constexpr (std::is_same_v<ElementType, double>)
+			equal = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(vector), _mm256_castsi256_pd(key), _CMP_EQ_OQ));
+		else if constexpr (sizeof(ElementType) == 1)
+			equal = _mm256_cmpeq_epi8(vector, key);
+		else if constexpr (sizeof(ElementType) == 2)
+			equal = _mm256_cmpeq_epi16(vector, key);
+		else if constexpr (sizeof(ElementType) == 4)
+			equal = _mm256_cmpeq_epi32(vector, key);
+		else
+			equal = _mm256_cmpeq_epi64(vector, key);
+		return equal;
+	}
+	template <Vectorizable ElementType>
+	SEQUENTIAL_SEARCH_AVX2 inline __m256i _Lane_Subtract_AVX2(__m256i counter, __m256i equal)
+	{
+		if constexpr (sizeof(ElementType) == 1)
+			return _mm256_sub_epi8(counter, equal);
+		else if constexpr (sizeof(ElementType) == 2)
+			return _mm256_sub_epi16(counter, equal);
+		else if constexpr (sizeof(ElementType) == 4)
+			return _mm256_sub_epi32(counter, equal);
+		else
+			return _mm256_sub_epi64(counter, equal);
+	}
+	template <Vectorizable ElementType>
+	SEQUENTIAL_SEARCH_AVX2 inline size_t _Lane_Sum_AVX2(__m256i counter)
+	{
+		Lane<ElementType> lanes[32 / sizeof(ElementType)];
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), counter);
+		size_t sum{};
+		for (auto lane : lanes)
+			sum += lane;
+		return sum;
+	}
+	template <Vectorizable ElementType>
+	SEQUENTIAL_SEARCH_AVX2 size_t Find_AVX2(const ElementType *data, size_t size, const ElementType &element)
+	{
+		constexpr size_t step = 32 / sizeof(ElementType);
+		__m256i key = _Broadcast_AVX2(element);
+		size_t index = 0;
+		for (; index + step <= size; index += step)
+			if (unsigned mask = _mm256_movemask_epi8(_Equal_AVX2(data + index, key)))
+				return index + std::countr_zero(mask) / sizeof(ElementType);
+		return index + Find_Scalar(data + index, size - index, element);
+	}
+	template <Vectorizable ElementType>
+	SEQUENTIAL_SEARCH_AVX2 size_t Count_AVX2(const ElementType *data, size_t size, const ElementType &element)
+	{
+		constexpr size_t step = 32 / sizeof(ElementType);
+		__m256i key = _Broadcast_AVX2(element);
+		size_t index = 0, count = 0;
+		while (index + step <= size)
+		{
+			__m256i counter = _mm256_setzero_si256();
+			for (size_t times = 0; times < lane_limit<ElementType> && index + step <= size; times++, index += step)
+				counter = _Lane_Subtract_AVX2<ElementType>(counter, _Equal_AVX2(data + index, key));
+			count += _Lane_Sum_AVX2<ElementType>(counter);
+		}
+		return count + Count_Scalar(data + index, size - index, element);
+	}
+#undef SEQUENTIAL_SEARCH_AVX2
+
+	// 运行时检测一次CPU是否支持AVX2
+	inline bool Has_AVX2()
+	{
+		static const bool has_avx2 = __builtin_cpu_supports("avx2");
+		return has_avx2;
+	}
+#endif
+
+	/// @brief 按元素类型和CPU选择内核
+	/// @return 第一个等于element的下标，不存在时返回size
+	template <typename ElementType>
+	size_t Find(const ElementType *data, size_t size, const ElementType &element)
+	{
+#ifdef SEQUENTIAL_SEARCH_SIMD
+		if constexpr (Vectorizable<ElementType>)
+			return Has_AVX2() ? Find_AVX2(data, size, element) : Find_SSE2(data, size, element);
+#endif
+		return Find_Scalar(data, size, element);
+	}
+	/// @brief 按元素类型和CPU选择内核，返回等于element的元素个数
+	template <typename ElementType>
+	size_t Count(const ElementType *data, size_t size, const ElementType &element)
+	{
+#ifdef SEQUENTIAL_SEARCH_SIMD
+		if constexpr (Vectorizable<ElementType>)
+			return Has_AVX2() ? Count_AVX2(data, size, element) : Count_SSE2(data, size, element);
+#endif
+		return Count_Scalar(data, size, element);
+	}
+}
@@ -23,11 +23,11 @@ namespace Logic
 		// 清空队列
 		virtual void Clear() = 0;
 		// 判断是否队空
-		bool Is_Empty() const { return size==0; }
+		virtual bool Is_Empty() const { return size==0; }
 		// virtual bool Is_Full() const = 0;
 
-		// 返回队列长度(元素个数)
-		size_t Get_Size() const { return size; }
+		// 返回队列长度(元素个数)。并发队列不使用size，由各自的下标计算
+		virtual size_t Get_Size() const { return size; }
 		// 返回队头
 		virtual ElementType &Get_Front()  = 0;
 		// 元素入队
@@ -3,80 +3,69 @@
 #include <iostream>
 #include "../Linear_Queue.hpp"
 #include "../../List_Node.hpp"
+#include "../../List_Node_Allocator.hpp"
 
 namespace Storage
 {
 	/// @tparam NodeType 默认使用单链节点
-	template <typename ElementType, typename NodeType = List_Node_SingleWay<ElementType>>
+	/// @tparam AllocatorPolicy 节点分配策略，见List_Node_Allocator.hpp
+	template <typename ElementType, typename NodeType = List_Node_SingleWay<ElementType>, typename AllocatorPolicy = Policy::Node_New>
 	class Link_Queue : public Logic::Queue<ElementType>
 	{ /// 循环队列
 	protected:
 		NodeType *front{}; // 指向首元节点
 		NodeType *rear{};  // 指向尾元节点
+		typename AllocatorPolicy::template Allocator<NodeType> allocator{}; // 节点分配器
+
+	protected:
+		// 按other的顺序拷贝所有元素到队尾
+		void _Copy_Elements(const Link_Queue &other)
+		{
+			for (NodeType *node = other.front; node; node = node->next)
+				Element_Enqueue(node->element);
+		}
 
 	public:
 		Link_Queue() = default;
 		Link_Queue(size_t size) : Logic::Queue<ElementType>(size){};
-		Link_Queue(const Link_Queue &other)
-			: Logic::Queue<ElementType>(other.size)
+		Link_Queue(const Link_Queue &other) : Logic::Queue<ElementType>()
 		{
 			if (this == &other)
 				throw std::logic_error("Self Coppied");
-			if (other.size == 0)
-				return;
-			else if (other.size == 1)
-				this->front = this->rear = new NodeType(other.front->element);
-			else
+			try
 			{
-				NodeType *node = other.front, *self{};
-				this->front = new NodeType(node->element);
-				self = this->front;
-				node = node->next;
-				while (node)
-				{
-					self->next = new NodeType(node->element);
-					self = self->next;
-					node = node->next;
-				}
-				this->rear = self;
+				_Copy_Elements(other);
+			}
+			catch (...) // 构造函数抛出时不调用析构函数，回收已拷贝的节点
+			{
+				allocator.Release(front);
+				throw;
 			}
 		}
 		Link_Queue(Link_Queue &&other)
-			: Logic::Queue<ElementType>(other.size), front{other.front}, rear{other.rear}
+			: Logic::Queue<ElementType>(other.size), front{other.front}, rear{other.rear}, allocator{std::move(other.allocator)}
 		{
+			other.front = other.rear = nullptr;
 			other.size = 0;
 		}
-		Link_Queue<ElementType, NodeType> &operator=(const Link_Queue &other)
+		Link_Queue<ElementType, NodeType, AllocatorPolicy> &operator=(const Link_Queue &other)
 		{
-			this->size = other.size;
-
 			if (this == &other)
 				throw std::logic_error("Self Coppied");
-			if (other.size == 0)
-				return Link_Queue<ElementType, NodeType>();
-			else if (other.size == 1)
-				this->front = this->rear = new NodeType(other.front->element);
-			else
-			{
-				NodeType *node = other.front, *self{};
-				this->front = new NodeType(node->element);
-				self = this->front;
-				node = node->next;
-				while (node)
-				{
-					self->next = new NodeType(node->element);
-					self = self->next;
-					node = node->next;
-				}
-				this->rear = self;
-			}
+			Clear();
+			_Copy_Elements(other);
 			return *this;
 		}
-		Link_Queue<ElementType, NodeType> &operator=(Link_Queue &&other)
+		Link_Queue<ElementType, NodeType, AllocatorPolicy> &operator=(Link_Queue &&other)
 		{
+			if (this == &other)
+				throw std::logic_error("Self Coppied");
+			Clear();
 			this->front = other.front;
 			this->rear = other.rear;
 			this->size = other.size;
+			allocator = std::move(other.allocator);
+			other.front = other.rear = nullptr;
 			other.size = 0;
 			return *this;
 		}
@@ -91,15 +80,7 @@ namespace Storage
 		// 清空队列(等价于销毁队列)，链式队列不需要空节点
 		virtual void Clear() override
 		{
-
-			for (size_t i = 0; i < this->size; i++)
-			{
-				NodeType *del{front};
-				if(!del)
-					throw std::runtime_error("Node Delete Failed: size does not match");
-				front = front->next;
-				delete del;
-			}
+			allocator.Release(front);
 			front = rear = nullptr;
 			this->size = 0;
 		}
@@ -134,7 +115,7 @@ namespace Storage
 	public: /// 元素操作
 		virtual void Element_Enqueue(const ElementType &element) override
 		{
-			NodeType *node = new NodeType(element);
+			NodeType *node = allocator.Allocate(element);
 			if (this->Is_Empty())
 				front = rear = node;
 			else
@@ -146,7 +127,7 @@ namespace Storage
 		}
 		virtual void Element_Enqueue(ElementType &&element) override
 		{
-			NodeType *node = new NodeType(std::move(element));
+			NodeType *node = allocator.Allocate(std::move(element));
 			if (this->Is_Empty())
 				front = rear = node;
 			else
@@ -162,7 +143,7 @@ namespace Storage
 				throw std::runtime_error("Pop faild , LinkQueue is empty");
 			if (this->size == 1)
 			{
-				delete front;
+				allocator.Deallocate(front);
 				front = nullptr;
 				rear = nullptr;
 			}
@@ -170,7 +151,7 @@ namespace Storage
 			{
 				NodeType *del = front;
 				front = front->next;
-				delete del;
+				allocator.Deallocate(del);
 			}
 			--this->size;
 		}
@@ -179,8 +160,8 @@ namespace Storage
 
 /// @tparam NodeType 默认使用单链节点
 /// @note 似乎链式队列实现没有什么变数,直接使用基类
-template <typename ElementType, typename NodeType = List_Node_SingleWay<ElementType>>
-using Link_Queue = Storage::Link_Queue<ElementType, NodeType>;
+template <typename ElementType, typename NodeType = List_Node_SingleWay<ElementType>, typename AllocatorPolicy = Policy::Node_New>
+using Link_Queue = Storage::Link_Queue<ElementType, NodeType, AllocatorPolicy>;
 
 #if __cplusplus >= 202002L
 static_assert(ADT::Linear_Queue<Link_Queue<int>, int>);
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+
+#include "../Linear_Queue.hpp"
+#include "../../Concurrent_Container.hpp"
+#include "../../List_Node.hpp"
+#include "../../List_Node_Allocator.hpp"
+#include "../../Memory_Reclamation.hpp"
+
+/// ============================================================================================================
+/// 无界无锁链式队列，Michael & Scott《Simple, Fast, and Practical Non-Blocking and Blocking Concurrent Queue Algorithms》
+/// - 链表带一个哨兵节点：front指向哨兵，哨兵的后继才是队头元素；rear指向最后一个或倒数第二个节点
+/// - 入队：CAS把新节点链接到最后一个节点的next(线性化点)，再尝试把rear后移
+/// - 出队：CAS把front后移到队头节点(线性化点)，队头节点成为新的哨兵，取出它的元素，旧哨兵交给回收域
+/// - 任何线程发现rear落后(rear->next非空)时都帮助后移rear，因此不会因为某个线程停顿而阻塞其他线程
+/// - 节点沿用List_Node_SingleWay，next通过std::atomic_ref原子访问
+///
+/// 内存回收
+/// - 出队的旧哨兵可能还被其他线程读取，交给Reclamation::Epoch_Domain在安全后回收
+/// - 回收在任意线程中进行，默认的Policy::Node_Thread_Cache把节点放入该线程的缓存，之后的入队复用
+///
+/// 线程约定(通用部分见Concurrent_Container.hpp)
+/// - Element_Enqueue/Element_Dequeue/Try_Dequeue/Clear 可以在任意多个线程中同时调用
+/// - ElementType需要可以默认构造(哨兵节点，出队时重置元素)
+/// ============================================================================================================
+
+namespace Storage
+{
+	/// @tparam AllocatorPolicy 节点分配策略。节点由回收域在任意线程中释放(见Epoch_Domain::Retire)，所以要求node_transferable
+	template <typename ElementType, typename AllocatorPolicy = Policy::Node_Thread_Cache<>>
+	class Link_Queue_Concurrent : public Logic::Queue<ElementType>
+	{
+	public:
+		using NodeType = List_Node_SingleWay<ElementType>;
+
+	private:
+		static_assert(AllocatorPolicy::node_transferable, "Link_Queue_Concurrent: nodes are freed by the reclamation domain and must not belong to the queue");
+		static_assert(std::atomic_ref<NodeType *>::required_alignment <= alignof(NodeType *), "Link_Queue_Concurrent: next can not be accessed atomically");
+		using Allocator = typename AllocatorPolicy::template Allocator<NodeType>;
+		static constexpr size_t cache_line = 64;
+
+		alignas(cache_line) std::atomic<NodeType *> front; // 哨兵节点，消费者之间竞争
+		alignas(cache_line) std::atomic<NodeType *> rear;  // 最后一个节点(可能落后一个)，生产者之间竞争
+		[[no_unique_address]] Allocator allocator{};
+
+	private:
+		static std::atomic_ref<NodeType *> _Next(NodeType *node) { return std::atomic_ref<NodeType *>(node->next); }
+		static void _Node_Free(void *node) { Allocator{}.Deallocate(static_cast<NodeType *>(node)); }
+
+		void _Enqueue(NodeType *node)
+		{
+			auto guard = Reclamation::Epoch_Domain::Global().Pin();
+			while (true)
+			{
+				NodeType *last = rear.load(std::memory_order_acquire);
+				NodeType *next = _Next(last).load(std::memory_order_acquire);
+				if (next)
+				{ // rear落后，帮助后移
+					rear.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+					continue;
+				}
+				// release：链接后其他线程能看到节点中构造好的元素
+				if (_Next(last).compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed))
+				{
+					rear.compare_exchange_strong(last, node, std::memory_order_release, std::memory_order_relaxed);
+					return;
+				}
+			}
+		}
+		/// 把front后移一个节点，对新哨兵中的元素调用consume，队空时返回false
+		template <typename Consume>
+		bool _Dequeue(Consume &&consume)
+		{
+			auto guard = Reclamation::Epoch_Domain::Global().Pin();
+			while (true)
+			{
+				NodeType *first = front.load(std::memory_order_acquire);
+				NodeType *next = _Next(first).load(std::memory_order_acquire);
+				if (!next)
+					return false;
+				NodeType *last = rear.load(std::memory_order_acquire);
+				if (first == last)
+				{ // rear还指向哨兵，先帮助后移，保证rear不会指向已回收的节点
+					rear.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+					continue;
+				}
+				if (front.compare_exchange_weak(first, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+				{ // next成为新的哨兵，它的元素只有本线程访问
+					consume(next->element);
+					Reclamation::Epoch_Domain::Global().Retire(first, _Node_Free);
+					return true;
+				}
+			}
+		}
+
+	protected:
+		ElementType &Get_Rear() override
+		{
+			NodeType *last = rear.load(std::memory_order_acquire);
+			while (NodeType *next = _Next(last).load(std::memory_order_acquire))
+				last = next;
+			if (last == front.load(std::memory_order_acquire))
+				throw std::runtime_error("Queue is Empty");
+			return last->element;
+		}
+
+	public:
+		Link_Queue_Concurrent() : Logic::Queue<ElementType>()
+		{
+			NodeType *sentinel = allocator.Allocate();
+			front.store(sentinel, std::memory_order_relaxed);
+			rear.store(sentinel, std::memory_order_relaxed);
+		}
+		Link_Queue_Concurrent(const Link_Queue_Concurrent &other) : Link_Queue_Concurrent()
+		{
+			for (NodeType *node = other.front.load()->next; node; node = node->next)
+				Element_Enqueue(node->element);
+		}
+		Link_Queue_Concurrent &operator=(const Link_Queue_Concurrent &) = delete;
+		/// 析构时没有其他线程访问，剩余节点(包括哨兵)直接回收
+		~Link_Queue_Concurrent() override
+		{
+			allocator.Release(front.load(std::memory_order_acquire));
+		}
+
+	public:
+		bool Is_Empty() const override
+		{
+			auto guard = Reclamation::Epoch_Domain::Global().Pin();
+			return _Next(front.load(std::memory_order_acquire)).load(std::memory_order_acquire) == nullptr;
+		}
+		/// @note 从哨兵沿next计数，O(n)。生产者只写rear、消费者只写front，计数器会成为双方共同写的缓存行
+		size_t Get_Size() const override
+		{
+			auto guard = Reclamation::Epoch_Domain::Global().Pin();
+			size_t count{};
+			for (NodeType *node = _Next(front.load(std::memory_order_acquire)).load(std::memory_order_acquire); node;
+				 node = _Next(node).load(std::memory_order_acquire))
+				++count;
+			return count;
+		}
+		// 清空队列：逐个出队，可以与其他线程并发调用
+		void Clear() override
+		{
+			while (_Dequeue(Discard_Element<ElementType>))
+				;
+		}
+		ElementType &Get_Front() override
+		{
+			auto guard = Reclamation::Epoch_Domain::Global().Pin();
+			NodeType *first = _Next(front.load(std::memory_order_acquire)).load(std::memory_order_acquire);
+			if (!first)
+				throw std::runtime_error("Queue is Empty");
+			return first->element;
+		}
+		void Queue_Show(const std::string &string = "") override
+		{
+			std::cout << string << std::endl
+					  << "[Size]:" << Get_Size() << std::endl
+					  << "[Front/Rear]: [" << front.load() << '/' << rear.load() << ']' << std::endl
+					  << "Queue: Front=》";
+			size_t index{1};
+			for (NodeType *node = front.load()->next; node; node = node->next, ++index)
+			{
+				std::cout << '[' << index << ':' << node->element << ']';
+				if (node->next)
+					std::cout << "->";
+			}
+			std::cout << "《=Rear" << std::endl;
+		}
+
+	public:
+		void Element_Enqueue(const ElementType &element) override { _Enqueue(allocator.Allocate(element)); }
+		void Element_Enqueue(ElementType &&element) override { _Enqueue(allocator.Allocate(std::move(element))); }
+		void Element_Dequeue() override
+		{
+			if (!_Dequeue(Discard_Element<ElementType>))
+				throw std::runtime_error("Dequeue Failed: Queue is Empty");
+		}
+		/// @brief 把队头元素移动到element并出队，队空时返回false
+		bool Try_Dequeue(ElementType &element)
+		{
+			return _Dequeue([&](ElementType &front_element) { element = std::move(front_element); });
+		}
+	};
+}
+
+template <typename ElementType, typename AllocatorPolicy = Policy::Node_Thread_Cache<>>
+using Link_Queue_Concurrent = Storage::Link_Queue_Concurrent<ElementType, AllocatorPolicy>;
+
+#if __cplusplus >= 202002L
+static_assert(ADT::Linear_Queue<Link_Queue_Concurrent<int>, int>);
+#endif
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <iostream>
+#include <memory> //construct_at
+#include <stdexcept>
+#include <utility> //exchange
+
+#include "../Linear_Queue.hpp"
+#include "../../../Uninitialized_Array.hpp"
+
+/// ============================================================================================================
+/// 分段链式队列：链接的是定长的块而不是单个元素，每块存放block_size个元素
+/// - 入队在rear块的rear_index处原地构造元素，块满时链接一个新块；出队析构front块front_index处的元素，块取空后回收
+/// - 回收的块挂在空闲链表上，之后需要新块时优先复用，稳定状态下入队出队不分配内存
+/// - 队列变空时front/rear回到同一块的开头，队列较短时始终只使用一个块
+/// - 与Link_Queue相比：每block_size个元素才分配一次，元素连续存放，遍历和出队都是顺序访问
+/// - Clear析构所有元素并释放所有块(包括空闲的块)
+/// ============================================================================================================
+
+namespace Storage
+{
+	/// @tparam block_size 每块的元素个数
+	template <typename ElementType, size_t block_size = 64>
+	class Link_Queue_Segmented : public Logic::Queue<ElementType>
+	{
+		static_assert(block_size > 0, "Queue Init Failed: block_size must be greater than 0");
+
+	private:
+		struct Block
+		{
+			Block *next{};
+			Uninitialized_Array<ElementType, block_size> elements; // 只有[front_index,rear_index)区间内构造了元素
+		};
+
+		Block *front{};			 // 队头所在的块
+		Block *rear{};			 // 队尾所在的块
+		size_t front_index{};	 // 队头元素在front块中的下标
+		size_t rear_index{};	 // 待插入位置在rear块中的下标
+		Block *free_blocks{};	 // 回收的空闲块
+
+	private:
+		Block *_Block_Acquire()
+		{
+			if (free_blocks)
+			{
+				Block *block = std::exchange(free_blocks, free_blocks->next);
+				block->next = nullptr;
+				return block;
+			}
+			return new Block;
+		}
+		void _Block_Recycle(Block *block)
+		{
+			block->next = free_blocks;
+			free_blocks = block;
+		}
+		/// 按从队头到队尾的顺序对每个元素调用function
+		template <typename Function>
+		void _For_Each(Function &&function) const
+		{
+			size_t index = front_index;
+			for (Block *block = front; block; block = block->next, index = 0)
+				for (size_t end = block == rear ? rear_index : block_size; index < end; index++)
+					function(block->elements[index]);
+		}
+		// 按other的顺序拷贝所有元素到队尾
+		void _Copy_Elements(const Link_Queue_Segmented &other)
+		{
+			other._For_Each([this](const ElementType &element) { Element_Enqueue(element); });
+		}
+		void _Take(Link_Queue_Segmented &other)
+		{
+			front = std::exchange(other.front, nullptr);
+			rear = std::exchange(other.rear, nullptr);
+			front_index = std::exchange(other.front_index, 0);
+			rear_index = std::exchange(other.rear_index, 0);
+			free_blocks = std::exchange(other.free_blocks, nullptr);
+			this->size = std::exchange(other.size, 0);
+		}
+		template <typename Element>
+		void _Enqueue(Element &&element)
+		{
+			if (rear && rear_index < block_size)
+				std::construct_at(rear->elements.Data() + rear_index++, std::forward<Element>(element));
+			else
+			{ // rear块已满或还没有块：先在新块中构造元素，成功后再链接，构造抛出异常时队列不变
+				Block *block = _Block_Acquire();
+				try
+				{
+					std::construct_at(block->elements.Data(), std::forward<Element>(element));
+				}
+				catch (...)
+				{
+					_Block_Recycle(block);
+					throw;
+				}
+				(rear ? rear->next : front) = block;
+				rear = block;
+				rear_index = 1;
+			}
+			++this->size;
+		}
+
+	protected:
+		ElementType &Get_Rear() override
+		{
+			if (this->Is_Empty())
+				throw std::runtime_error("Queue is Empty");
+			return rear->elements[rear_index - 1];
+		}
+
+	public:
+		Link_Queue_Segmented() = default;
+		Link_Queue_Segmented(const Link_Queue_Segmented &other) : Logic::Queue<ElementType>()
+		{
+			_Copy_Elements(other);
+		}
+		Link_Queue_Segmented(Link_Queue_Segmented &&other) : Logic::Queue<ElementType>()
+		{
+			_Take(other);
+		}
+		Link_Queue_Segmented &operator=(const Link_Queue_Segmented &other)
+		{
+			if (this == &other)
+				throw std::logic_error("Self Coppied");
+			Clear();
+			_Copy_Elements(other);
+			return *this;
+		}
+		Link_Queue_Segmented &operator=(Link_Queue_Segmented &&other)
+		{
+			if (this == &other)
+				throw std::logic_error("Self Coppied");
+			Clear();
+			_Take(other);
+			return *this;
+		}
+		~Link_Queue_Segmented() override
+		{
+			Clear();
+		}
+
+	public:
+		// 清空队列，析构所有元素并释放所有块
+		void Clear() override
+		{
+			_For_Each([](ElementType &element) { std::destroy_at(&element); });
+			while (front)
+				delete std::exchange(front, front->next);
+			while (free_blocks)
+				delete std::exchange(free_blocks, free_blocks->next);
+			rear = nullptr;
+			front_index = rear_index = 0;
+			this->size = 0;
+		}
+		ElementType &Get_Front() override
+		{
+			if (this->Is_Empty())
+				throw std::runtime_error("Queue is Empty");
+			return front->elements[front_index];
+		}
+		void Queue_Show(const std::string &string = "") override
+		{
+			std::cout << string << std::endl
+					  << "[Size/Block_Size]:" << this->size << '/' << block_size << std::endl
+					  << "[Front/Rear]: [" << front << ':' << front_index << '/' << rear << ':' << rear_index << ']' << std::endl
+					  << "Queue: Front=》";
+			size_t index{1};
+			_For_Each([&](const ElementType &element) { std::cout << '[' << index++ << ':' << element << ']'; });
+			std::cout << "《=Rear" << std::endl;
+		}
+
+	public:
+		void Element_Enqueue(const ElementType &element) override { _Enqueue(element); }
+		void Element_Enqueue(ElementType &&element) override { _Enqueue(std::move(element)); }
+		void Element_Dequeue() override
+		{
+			if (this->Is_Empty())
+				throw std::runtime_error("Dequeue Failed: Queue is Empty");
+			std::destroy_at(front->elements.Data() + front_index++);
+			if (--this->size == 0) // 队列变空，front和rear在同一块中，从块的开头重新使用
+				front_index = rear_index = 0;
+			else if (front_index == block_size)
+			{
+				_Block_Recycle(std::exchange(front, front->next));
+				front_index = 0;
+			}
+		}
+	};
+}
+
+template <typename ElementType, size_t block_size = 64>
+using Link_Queue_Segmented = Storage::Link_Queue_Segmented<ElementType, block_size>;
+
+#if __cplusplus >= 202002L
+static_assert(ADT::Linear_Queue<Link_Queue_Segmented<int>, int>);
+#endif
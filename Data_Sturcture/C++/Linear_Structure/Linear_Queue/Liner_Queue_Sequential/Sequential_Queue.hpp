@@ -1,11 +1,16 @@
 #pragma once
 
+#include <algorithm> //min
 #include <iostream>
+#include <memory> //construct_at
+#include <span>
 
 #include "../Linear_Queue.hpp"
+#include "../../../Uninitialized_Array.hpp"
 
 /// ============================================================================================================
-/// 		由于队列通常用作为缓冲，所以顺序队列仅实现栈分配。要动态内存请使用链式队列,使ElementType为一块数组以实现
+/// 		由于队列通常用作为缓冲，所以顺序队列仅实现栈分配。长度不确定时使用Sequential_Queue_Growable.hpp中堆上的可增长顺序队列
+/// 队列数组为未初始化内存，入队时原地构造元素，出队时析构元素，只有[front,rear)环形区间内的位置构造了对象
 /// ============================================================================================================
 namespace Storage
 {
@@ -33,7 +38,50 @@ namespace Storage
 		}
 		virtual ElementType &Get_Rear() = 0;
 		virtual ElementType &Get_Front() = 0;
-		
+
+		// 队列中第i个元素(0开始)在数组中的下标
+		size_t _Index_Of(size_t i) const { return (front + i) % capcity; }
+		// 数组下标index处是否构造了元素
+		bool _Is_Live(size_t index) const { return (index + capcity - front) % capcity < this->size; }
+		// 在未初始化的storage中按相同下标拷贝构造other的有效元素，调用前front和size已与other一致
+		void _Copy_Elements(const Sequential_Queue<ElementType, maxsize> &other)
+		{
+			for (size_t i = 0; i < other.size; i++)
+				std::construct_at(storage + other._Index_Of(i), other.storage[other._Index_Of(i)]);
+		}
+		// 在未初始化的storage中按相同下标移动构造other的有效元素，并清空other
+		void _Move_Elements(Sequential_Queue<ElementType, maxsize> &other)
+		{
+			for (size_t i = 0; i < other.size; i++)
+				std::construct_at(storage + other._Index_Of(i), std::move(other.storage[other._Index_Of(i)]));
+			other.Clear();
+		}
+		// 批量入队/出队修改size、front、rear之后调用，派生类在此维护自己的判满状态
+		virtual void _After_Bulk() {}
+		/// @brief 批量入队的两段构造，relocate(source,n,destination)在未初始化的位置上拷贝或移动构造n个元素
+		/// @note 第二段抛出异常时第一段已经入队，同样调用_After_Bulk
+		template <typename SourceType, typename Relocate>
+		size_t _Enqueue_Bulk(SourceType *source, size_t source_size, Relocate relocate)
+		{
+			size_t count = std::min(source_size, maxsize - this->size);
+			size_t first = std::min(count, capcity - rear); // 到数组末尾之前的一段
+			relocate(source, first, storage + rear);
+			rear = (rear + first) % capcity;
+			this->size += first;
+			try
+			{
+				relocate(source + first, count - first, storage); // 绕回数组头部的一段
+			}
+			catch (...)
+			{
+				_After_Bulk();
+				throw;
+			}
+			rear += count - first;
+			this->size += count - first;
+			_After_Bulk();
+			return count;
+		}
 
 	public: /// Redundancy
 		// Sequential_Queue()
@@ -48,18 +96,11 @@ namespace Storage
 	public:
 		virtual bool Is_Full() const = 0;
 		constexpr size_t Get_Capcity() const { return capcity; }
+		// 清空队列，只析构有效元素
 		virtual void Clear()
 		{
-			if (std::is_pointer<ElementType>::value)
-			{
-				std::cout << " pointer elements' clear not implemented yet ." << std::endl;
-				return;
-			}
 			for (size_t i = 0; i < this->size; i++)
-			{
-				std::destroy(this->storage, this->storage + this->size);
-				this->storage[i] = ElementType();
-			}
+				std::destroy_at(storage + _Index_Of(i));
 
 			this->size = front = rear = size_t{};
 		}
@@ -70,6 +111,38 @@ namespace Storage
 		virtual void Element_Enqueue(ElementType &&element) = 0;
 		virtual void Element_Enqueue(const ElementType &element) = 0;
 		virtual void Element_Dequeue() = 0;
+
+	public: /// 批量操作：环形区间最多分成[index,capcity)和[0,...)两段，每段一次连续拷贝/移动，只计算一次下标和剩余空间
+		/// @brief 把elements依次拷贝入队，队列放不下时只入队前面的部分
+		/// @return 实际入队的元素个数
+		/// @note 直接传入可修改的容器时两个重载有歧义：拷贝传入std::as_const(container)，移动传入std::span(container)
+		size_t Enqueue_Bulk(std::span<const ElementType> elements)
+		{
+			return _Enqueue_Bulk(elements.data(), elements.size(), [](const ElementType *source, size_t count, ElementType *destination)
+								 { std::uninitialized_copy_n(source, count, destination); });
+		}
+		/// @brief 把elements依次移动入队，队列放不下时只移动前面的部分，其余元素不变
+		/// @return 实际入队的元素个数
+		size_t Enqueue_Bulk(std::span<ElementType> elements)
+		{
+			return _Enqueue_Bulk(elements.data(), elements.size(), [](ElementType *source, size_t count, ElementType *destination)
+								 { std::uninitialized_move_n(source, count, destination); });
+		}
+		/// @brief 依次出队，元素移动到elements中，队列元素不足时只填充前面的部分
+		/// @return 实际出队的元素个数
+		size_t Dequeue_Bulk(std::span<ElementType> elements)
+		{
+			size_t count = std::min(elements.size(), this->size);
+			size_t first = std::min(count, capcity - front);
+			std::move(storage + front, storage + front + first, elements.data());
+			std::destroy_n(storage + front, first);
+			std::move(storage, storage + (count - first), elements.data() + first);
+			std::destroy_n(storage, count - first);
+			front = (front + count) % capcity;
+			this->size -= count;
+			_After_Bulk();
+			return count;
+		}
 	};
 }
 
@@ -79,73 +152,62 @@ template <typename ElementType, size_t maxsize>
 struct Sequential_Queue_Redundancy : public Storage::Sequential_Queue<ElementType, maxsize>
 {
 private:
-	ElementType array[maxsize+1]{};
+	Uninitialized_Array<ElementType, maxsize + 1> array;
 
 public:
-	Sequential_Queue_Redundancy() 
-	: Storage::Sequential_Queue<ElementType, maxsize>(maxsize+1, array)
+	Sequential_Queue_Redundancy()
+		: Storage::Sequential_Queue<ElementType, maxsize>(maxsize + 1, array.Data())
 	{
 		static_assert(maxsize > 0, "Queue Init Failed: maxsize must be greater than 0");
 	}
 	Sequential_Queue_Redundancy(const Sequential_Queue_Redundancy<ElementType, maxsize> &other)
-		: Storage::Sequential_Queue<ElementType, maxsize>(other.capcity, array, other.size)
+		: Storage::Sequential_Queue<ElementType, maxsize>(other.capcity, array.Data(), other.size)
 	{
 		this->front = other.front;
 		this->rear = other.rear;
-		for (size_t i = 0; i < maxsize; i++)
-			array[i] = other.array[i];
+		this->_Copy_Elements(other);
 	}
 	Sequential_Queue_Redundancy(Sequential_Queue_Redundancy<ElementType, maxsize> &&other)
-		: Storage::Sequential_Queue<ElementType, maxsize>(other.capcity, array, other.size)
+		: Storage::Sequential_Queue<ElementType, maxsize>(other.capcity, array.Data(), other.size)
 	{
 		this->front = other.front;
 		this->rear = other.rear;
-		other.front = size_t{};
-		other.rear = size_t{};
-		other.size = size_t{};
-		for (size_t i = 0; i < maxsize; i++)
-		{
-			array[i] = std::move(other.array[i]);
-			other.array[i] = ElementType{};
-		}
+		this->_Move_Elements(other);
 	}
 	Sequential_Queue_Redundancy<ElementType, maxsize> &operator=(const Sequential_Queue_Redundancy<ElementType, maxsize> &other)
 	{
+		if (this == &other)
+			throw std::logic_error("Self Copied");
+		Clear();
+		this->size = other.size;
 		this->front = other.front;
 		this->rear = other.rear;
-		for (size_t i = 0; i < maxsize; i++)
-			array[i] = other.array[i];
+		this->_Copy_Elements(other);
 		return *this;
 	}
 
 	Sequential_Queue_Redundancy<ElementType, maxsize> &operator=(Sequential_Queue_Redundancy<ElementType, maxsize> &&other)
 	{
+		if (this == &other)
+			throw std::logic_error("Self Copied");
+		Clear();
+		this->size = other.size;
 		this->front = other.front;
 		this->rear = other.rear;
-		other.front = size_t{};
-		other.rear = size_t{};
-		other.size = size_t{};
-		for (size_t i = 0; i < maxsize; i++)
-		{
-			array[i] = std::move(other.array[i]);
-			other.array[i] = ElementType{};
-		}
+		this->_Move_Elements(other);
 		return *this;
 	}
 
-		virtual ~Sequential_Queue_Redundancy()
+	virtual ~Sequential_Queue_Redundancy()
 	{
-		// std::cout << "Sequential_Queue Destroyed" << std::endl;
+		Clear();
 	}
 
 public:
 	virtual bool Is_Full() const override { return (this->rear + 1) % (maxsize + 1) == this->front; }
 	void Clear() override
 	{
-		for (size_t i = 0; i < this->capcity; i++) // 冗余的元素也要重置
-			this->storage[i] = std::move(ElementType()); // 使用 std::move 移动构造重置元素
-
-		this->size = this->front = this->rear = 0;
+		Storage::Sequential_Queue<ElementType, maxsize>::Clear();
 	}
 
 	ElementType &Get_Rear() override
@@ -171,7 +233,12 @@ public:
 				  << "[Front/Rear/Redundancy]: [" << this->front << '/' << this->rear << '/' << maxsize << ']' << std::endl
 				  << "Queue-";
 		for (size_t index = 0; index < maxsize + 1; index++)
-			std::cout << '[' << index << ':' << this->storage[index] << "]-";
+		{ // 空闲位置没有构造元素，只显示下标
+			std::cout << '[' << index << ':';
+			if (this->_Is_Live(index))
+				std::cout << this->storage[index];
+			std::cout << "]-";
+		}
 		std::cout << "End" << std::endl;
 	}
 
@@ -183,7 +250,7 @@ public:
 		if (Is_Full())
 			throw std::runtime_error("Enqueue Failed: Queue is Full");
 
-		this->storage[this->rear] = element;
+		std::construct_at(this->storage + this->rear, element);
 		this->rear = (this->rear + 1) % (maxsize + 1);
 		this->size++;
 	}
@@ -194,7 +261,7 @@ public:
 		if (Is_Full())
 			throw std::runtime_error("Enqueue Failed: Queue is Full");
 
-		this->storage[this->rear] = element;
+		std::construct_at(this->storage + this->rear, std::move(element));
 		this->rear = (this->rear + 1) % (maxsize + 1);
 		this->size++;
 	}
@@ -202,7 +269,7 @@ public:
 	{
 		if (this->Is_Empty())
 			throw std::runtime_error("Dequeue Failed: Queue is Empty");
-		this->storage[this->front] = ElementType{};
+		std::destroy_at(this->storage + this->front);
 		this->front = (this->front + 1) % (maxsize + 1);
 		--this->size;
 	}
@@ -214,80 +281,77 @@ struct Sequential_Queue_Tag : public Storage::Sequential_Queue<ElementType, maxs
 {
 private:
 	bool full{false};
-	ElementType array[maxsize]{};
+	Uninitialized_Array<ElementType, maxsize> array;
 
 	virtual ElementType &Get_Rear() override
 	{
 		if (this->Is_Empty())
 			throw std::runtime_error("Queue is Empty");
 		/// rear指向待插入位置索引，返回前一个元素索引
-		return this->storage[this->rear];
+		return this->storage[(this->rear + maxsize - 1) % maxsize];
 	}
+	// 基类的Enqueue_Bulk/Dequeue_Bulk(包括通过基类引用调用时)之后更新full
+	void _After_Bulk() override { full = this->size == maxsize; }
 
 public:
-	Sequential_Queue_Tag() : Storage::Sequential_Queue<ElementType, maxsize>(maxsize, array)
+	Sequential_Queue_Tag() : Storage::Sequential_Queue<ElementType, maxsize>(maxsize, array.Data())
 	{
 		static_assert(maxsize > 0, "Queue Init Failed: maxsize must be greater than 0");
 	}
 	Sequential_Queue_Tag(const Sequential_Queue_Tag<ElementType, maxsize> &other)
-		: Storage::Sequential_Queue<ElementType, maxsize>(other.capcity, array, other.size)
+		: Storage::Sequential_Queue<ElementType, maxsize>(other.capcity, array.Data(), other.size)
 	{
 		this->front = other.front;
 		this->rear = other.rear;
 		full = other.full;
-		for (size_t i = 0; i < maxsize; i++)
-			array[i] = other.array[i];
+		this->_Copy_Elements(other);
 	}
 	Sequential_Queue_Tag(Sequential_Queue_Tag<ElementType, maxsize> &&other)
-		: Storage::Sequential_Queue<ElementType, maxsize>(other.capcity, array, other.size)
+		: Storage::Sequential_Queue<ElementType, maxsize>(other.capcity, array.Data(), other.size)
 	{
 		this->front = other.front;
 		this->rear = other.rear;
 		full = other.full;
-		other.full = false;
-		other.front = size_t{};
-		other.rear = size_t{};
-		other.size = size_t{};
-		for (size_t i = 0; i < maxsize; i++)
-		{
-			array[i] = std::move(other.array[i]);
-			other.array[i] = ElementType{};
-		}
+		this->_Move_Elements(other);
 	}
 	Sequential_Queue_Tag<ElementType, maxsize> &operator=(const Sequential_Queue_Tag<ElementType, maxsize> &other)
 	{
+		if (this == &other)
+			throw std::logic_error("Self Copied");
+		Clear();
+		this->size = other.size;
 		this->front = other.front;
 		this->rear = other.rear;
 		full = other.full;
-		for (size_t i = 0; i < maxsize; i++)
-			array[i] = other.array[i];
+		this->_Copy_Elements(other);
 		return *this;
 	}
 
 	Sequential_Queue_Tag<ElementType, maxsize> &operator=(Sequential_Queue_Tag<ElementType, maxsize> &&other)
 	{
+		if (this == &other)
+			throw std::logic_error("Self Copied");
+		Clear();
+		this->size = other.size;
 		this->front = other.front;
 		this->rear = other.rear;
 		full = other.full;
-		other.full = false;
-		other.front = size_t{};
-		other.rear = size_t{};
-		other.size = size_t{};
-		for (size_t i = 0; i < maxsize; i++)
-		{
-			array[i] = std::move(other.array[i]);
-			other.array[i] = ElementType{};
-		}
+		this->_Move_Elements(other);
 		return *this;
 	}
 
 	~Sequential_Queue_Tag() override
 	{
-		// std::cout << "Sequential_Queue_Tag Destroyed" << std::endl;
+		Clear();
 	}
 
 public:
 	bool Is_Full() const override final { return full; }
+	void Clear() override
+	{
+		Storage::Sequential_Queue<ElementType, maxsize>::Clear();
+		full = false;
+	}
 	ElementType &Get_Front() override
 	{
 		if (this->Is_Empty())
@@ -303,7 +367,12 @@ public:
 				  << "[Front/Rear]=[" << this->front << '/' << this->rear << ']' << std::endl
 				  << "Queue-";
 		for (size_t index = 0; index < maxsize; index++)
-			std::cout << '[' << index << ':' << this->storage[index] << "]-";
+		{ // 空闲位置没有构造元素，只显示下标
+			std::cout << '[' << index << ':';
+			if (this->_Is_Live(index))
+				std::cout << this->storage[index];
+			std::cout << "]-";
+		}
 		std::cout << "End" << std::endl;
 	}
 
@@ -314,7 +383,7 @@ public:
 			throw std::runtime_error("SeqQueue is not exist");
 		if (Is_Full())
 			throw std::runtime_error("Enqueue Failed: Queue is Full");
-		this->storage[this->rear] = element;
+		std::construct_at(this->storage + this->rear, element);
 		this->rear = (this->rear + 1) % maxsize;
 		this->size++;
 
@@ -327,7 +396,7 @@ public:
 			throw std::runtime_error("SeqQueue is not exist");
 		if (Is_Full())
 			throw std::runtime_error("Enqueue Failed: Queue is Full");
-		this->storage[this->rear] = element;
+		std::construct_at(this->storage + this->rear, std::move(element));
 		this->rear = (this->rear + 1) % maxsize;
 		this->size++;
 
@@ -338,7 +407,7 @@ public:
 	{
 		if (this->Is_Empty())
 			throw std::runtime_error("Dequeue Faild: Queue is empty");
-		this->storage[this->front] = ElementType();
+		std::destroy_at(this->storage + this->front);
 		this->front = (this->front + 1) % maxsize;
 		this->size--;
 
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm> //min max
+#include <bit>		 //bit_ceil
+#include <iostream>
+#include <memory> //allocator construct_at
+#include <stdexcept>
+#include <type_traits>
+#include <utility> //exchange
+
+#include "../Linear_Queue.hpp"
+
+/// ============================================================================================================
+/// 可增长的顺序队列：堆上的环形数组，队满时容量翻倍，队列长度不受限制
+/// - 容量始终是2的幂，下标用 & (capcity-1) 代替取模；队列中的元素为[front,front+size)环形区间
+/// - 扩容时环形区间最多分成[front,capcity)和[0,...)两段，各用一次连续移动放到新数组的开头
+/// 		元素的移动构造不抛出异常(或不可拷贝)时移动，否则拷贝，扩容失败时队列不变
+/// - shrink为true时，出队后元素个数不超过容量的1/4则容量减半(不小于初始容量)，在1/4处收缩避免在边界反复扩容和收缩
+///   也可以随时调用Shrink_To_Fit收缩
+/// - 与Link_Queue相比：元素连续存放，没有每个元素的节点分配；扩容的均摊开销为每个元素O(1)次移动
+/// ============================================================================================================
+
+/// @tparam shrink 出队后是否自动收缩容量
+template <typename ElementType, bool shrink = false>
+class Sequential_Queue_Growable : public Logic::Queue<ElementType>
+{
+private:
+	ElementType *storage{};			 // 队列数组，只有[front,front+size)环形区间内构造了元素
+	size_t capcity{};				 // 数组容量，0或2的幂
+	size_t front{};					 // 队头下标
+	size_t minimum_capcity{};		 // 第一次分配和收缩时的最小容量
+	[[no_unique_address]] std::allocator<ElementType> allocator{};
+
+private:
+	// 队列中第i个元素(0开始)在数组中的下标
+	size_t _Index_Of(size_t i) const { return (front + i) & (capcity - 1); }
+
+	/// 把count个元素从source移动(或拷贝)构造到未初始化的destination
+	static void _Relocate(ElementType *source, size_t count, ElementType *destination)
+	{
+		if constexpr (std::is_nothrow_move_constructible_v<ElementType> || !std::is_copy_constructible_v<ElementType>)
+			std::uninitialized_move_n(source, count, destination);
+		else
+			std::uninitialized_copy_n(source, count, destination);
+	}
+	/// 换成容量为capcity_new的数组，元素按顺序放到新数组的开头
+	void _Reallocate(size_t capcity_new)
+	{
+		ElementType *buffer = allocator.allocate(capcity_new);
+		size_t first = std::min(this->size, capcity - front); // 到数组末尾之前的一段
+		try
+		{
+			_Relocate(storage + front, first, buffer);
+			try
+			{
+				_Relocate(storage, this->size - first, buffer + first); // 绕回数组头部的一段
+			}
+			catch (...)
+			{
+				std::destroy_n(buffer, first);
+				throw;
+			}
+		}
+		catch (...)
+		{
+			allocator.deallocate(buffer, capcity_new);
+			throw;
+		}
+		std::destroy_n(storage + front, first);
+		std::destroy_n(storage, this->size - first);
+		if (storage)
+			allocator.deallocate(storage, capcity);
+		storage = buffer;
+		capcity = capcity_new;
+		front = 0;
+	}
+	template <typename Element>
+	void _Enqueue(Element &&element)
+	{
+		if (this->size == capcity)
+		{ // 先构造出新元素再扩容：element可能引用队列中的元素，扩容后失效
+			ElementType temporary(std::forward<Element>(element));
+			_Reallocate(capcity ? capcity * 2 : minimum_capcity);
+			std::construct_at(storage + _Index_Of(this->size), std::move(temporary));
+		}
+		else
+			std::construct_at(storage + _Index_Of(this->size), std::forward<Element>(element));
+		++this->size;
+	}
+	// 在空队列中按顺序拷贝other的所有元素
+	void _Copy_Elements(const Sequential_Queue_Growable &other)
+	{
+		if (other.size > capcity)
+			_Reallocate(std::max(minimum_capcity, std::bit_ceil(other.size)));
+		for (size_t i = 0; i < other.size; i++)
+		{
+			std::construct_at(storage + i, other.storage[other._Index_Of(i)]);
+			++this->size;
+		}
+	}
+	// 接管other的数组和收缩下限，other成为没有分配的空队列
+	void _Take(Sequential_Queue_Growable &other)
+	{
+		minimum_capcity = other.minimum_capcity;
+		storage = std::exchange(other.storage, nullptr);
+		capcity = std::exchange(other.capcity, 0);
+		front = std::exchange(other.front, 0);
+		this->size = std::exchange(other.size, 0);
+	}
+	void _Free()
+	{
+		Clear();
+		if (storage)
+			allocator.deallocate(storage, capcity);
+		storage = nullptr;
+		capcity = 0;
+	}
+
+protected:
+	ElementType &Get_Rear() override
+	{
+		if (this->Is_Empty())
+			throw std::runtime_error("Queue is Empty");
+		return storage[_Index_Of(this->size - 1)];
+	}
+
+public:
+	/// @param capcity 初始容量，向上取整为2的幂。第一次入队时才分配
+	explicit Sequential_Queue_Growable(size_t capcity = 16)
+		: Logic::Queue<ElementType>(), minimum_capcity{std::bit_ceil(std::max<size_t>(capcity, 1))} {}
+	Sequential_Queue_Growable(const Sequential_Queue_Growable &other)
+		: Logic::Queue<ElementType>(), minimum_capcity{other.minimum_capcity}
+	{
+		_Copy_Elements(other);
+	}
+	Sequential_Queue_Growable(Sequential_Queue_Growable &&other)
+		: Logic::Queue<ElementType>()
+	{
+		_Take(other);
+	}
+	Sequential_Queue_Growable &operator=(const Sequential_Queue_Growable &other)
+	{
+		if (this == &other)
+			throw std::logic_error("Self Copied");
+		Clear();
+		minimum_capcity = other.minimum_capcity;
+		_Copy_Elements(other);
+		return *this;
+	}
+	Sequential_Queue_Growable &operator=(Sequential_Queue_Growable &&other)
+	{
+		if (this == &other)
+			throw std::logic_error("Self Copied");
+		_Free();
+		_Take(other);
+		return *this;
+	}
+	~Sequential_Queue_Growable() override
+	{
+		_Free();
+	}
+
+public:
+	size_t Get_Capcity() const { return capcity; }
+	/// @brief 预留至少capcity个元素的空间，之后入队到该长度前不再扩容
+	void Reserve(size_t capcity_new)
+	{
+		if (capcity_new > capcity)
+			_Reallocate(std::bit_ceil(capcity_new));
+	}
+	/// @brief 把容量收缩到能容纳当前元素的最小的2的幂(不小于初始容量)
+	void Shrink_To_Fit()
+	{
+		size_t capcity_new = std::max(minimum_capcity, std::bit_ceil(this->size));
+		if (capcity_new < capcity)
+			_Reallocate(capcity_new);
+	}
+	// 清空队列，只析构有效元素，保留容量
+	void Clear() override
+	{
+		for (size_t i = 0; i < this->size; i++)
+			std::destroy_at(storage + _Index_Of(i));
+		this->size = front = 0;
+	}
+	ElementType &Get_Front() override
+	{
+		if (this->Is_Empty())
+			throw std::runtime_error("Queue is Empty");
+		return storage[front];
+	}
+	void Queue_Show(const std::string &string = "") override
+	{
+		std::cout << string << std::endl
+				  << "[Size/Capcity]=[" << this->size << '/' << capcity << ']' << std::endl
+				  << "[Front/Rear]=[" << front << '/' << (capcity ? _Index_Of(this->size) : 0) << ']' << std::endl
+				  << "Queue-";
+		for (size_t i = 0; i < this->size; i++)
+			std::cout << '[' << _Index_Of(i) << ':' << storage[_Index_Of(i)] << "]-";
+		std::cout << "End" << std::endl;
+	}
+
+public:
+	void Element_Enqueue(const ElementType &element) override { _Enqueue(element); }
+	void Element_Enqueue(ElementType &&element) override { _Enqueue(std::move(element)); }
+	void Element_Dequeue() override
+	{
+		if (this->Is_Empty())
+			throw std::runtime_error("Dequeue Failed: Queue is Empty");
+		std::destroy_at(storage + front);
+		front = (front + 1) & (capcity - 1);
+		--this->size;
+		if constexpr (shrink)
+			if (capcity > minimum_capcity && this->size <= capcity / 4)
+			{
+				try
+				{
+					_Reallocate(capcity / 2);
+				}
+				catch (...) // 出队已经完成，收缩失败时保持原容量
+				{
+				}
+			}
+	}
+};
+
+#if __cplusplus >= 202002L
+static_assert(ADT::Linear_Queue<Sequential_Queue_Growable<int>, int>);
+#endif
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <atomic>
+#include <bit> //has_single_bit
+#include <iostream>
+#include <memory> //construct_at
+#include <stdexcept>
+#include <type_traits>
+
+#include "../Linear_Queue.hpp"
+#include "../../Concurrent_Container.hpp"
+#include "../../../Uninitialized_Array.hpp"
+
+/// ============================================================================================================
+/// 多生产者多消费者(MPMC)的有界无锁队列，Vyukov的bounded MPMC queue，用于线程池的任务队列
+/// - 容量为2的幂，下标用 & mask 代替 % capcity；入队位置/出队位置只增不减，分别位于独立的缓存行
+/// - 每个槽位带一个序号sequence，表示槽位当前可以被哪一次操作使用：
+/// 		sequence == pos     槽位空闲，可以被第pos次入队使用
+/// 		sequence == pos+1   槽位已写入，可以被第pos次出队使用
+/// 		出队后sequence = pos+capcity，留给下一轮的第pos+capcity次入队
+/// - 线程用CAS抢占入队/出队位置，抢到后独占该槽位读写元素，再release存储新的序号发布结果
+/// 		不同槽位上的操作互不等待；只有读写同一位置的线程之间竞争CAS
+/// - 队满/队空由序号判断，不需要额外的size计数
+/// - 抢占槽位之后只做不抛出异常的移动构造/移动赋值/析构，序号一定会被发布；拷贝入队先在抢占之前构造临时对象，
+///   拷贝抛出异常时没有占用任何槽位。否则被抢占的槽位序号永远不会推进，之后该槽位一直表现为队满或队空
+///
+/// 线程约定(通用部分见Concurrent_Container.hpp)
+/// - Element_Enqueue/Try_Enqueue/Element_Dequeue/Try_Dequeue/Clear 可以在任意多个线程中同时调用，Clear逐个出队
+/// - Is_Full与Get_Size一样由两个位置相减得到，并发时是近似值
+/// ============================================================================================================
+
+/// @tparam capcity 队列容量，必须是2的幂
+template <typename ElementType, size_t capcity>
+class Sequential_Queue_MPMC : public Logic::Queue<ElementType>
+{
+	static_assert(std::has_single_bit(capcity), "Queue Init Failed: capcity must be a power of 2");
+	static_assert(std::is_nothrow_move_constructible_v<ElementType> && std::is_nothrow_move_assignable_v<ElementType>,
+				  "Sequential_Queue_MPMC: a claimed cell must always be published, element moves must not throw");
+	static constexpr size_t mask = capcity - 1;
+	static constexpr size_t cache_line = 64;
+
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		Uninitialized_Array<ElementType, 1> element;
+	};
+
+private:
+	alignas(cache_line) std::atomic<size_t> enqueue_position{}; // 下一次入队的位置，生产者之间竞争
+	alignas(cache_line) std::atomic<size_t> dequeue_position{}; // 下一次出队的位置，消费者之间竞争
+	alignas(cache_line) Cell cells[capcity];
+
+private:
+	/// 抢占一个可以入队的槽位并移动构造元素，队满时返回false
+	bool _Enqueue(ElementType &&element)
+	{
+		size_t position = enqueue_position.load(std::memory_order_relaxed);
+		Cell *cell;
+		while (true)
+		{
+			cell = &cells[position & mask];
+			// acquire与出队时的release配对：序号为position时，上一轮的元素已经析构
+			size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+			if (difference == 0)
+			{
+				if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (difference < 0) // 槽位仍是上一轮未出队的元素
+				return false;
+			else // 其他生产者已经使用了position，重新读取
+				position = enqueue_position.load(std::memory_order_relaxed);
+		}
+		std::construct_at(cell->element.Data(), std::move(element));
+		cell->sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+	/// 抢占一个已写入的槽位，对元素调用consume后析构，队空时返回false
+	template <typename Consume>
+	bool _Dequeue(Consume &&consume)
+	{
+		size_t position = dequeue_position.load(std::memory_order_relaxed);
+		Cell *cell;
+		while (true)
+		{
+			cell = &cells[position & mask];
+			// acquire与入队时的release配对：序号为position+1时，元素已经构造
+			size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			auto difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+			if (difference == 0)
+			{
+				if (dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (difference < 0) // 槽位尚未写入
+				return false;
+			else // 其他消费者已经使用了position，重新读取
+				position = dequeue_position.load(std::memory_order_relaxed);
+		}
+		consume(cell->element[0]);
+		std::destroy_at(cell->element.Data());
+		cell->sequence.store(position + capcity, std::memory_order_release);
+		return true;
+	}
+
+protected:
+	ElementType &Get_Rear() override
+	{
+		size_t position = enqueue_position.load(std::memory_order_relaxed);
+		Cell &cell = cells[(position - 1) & mask];
+		if (position == 0 || cell.sequence.load(std::memory_order_acquire) != position)
+			throw std::runtime_error("Queue is Empty");
+		return cell.element[0];
+	}
+
+public:
+	Sequential_Queue_MPMC() : Logic::Queue<ElementType>()
+	{
+		for (size_t index = 0; index < capcity; index++)
+			cells[index].sequence.store(index, std::memory_order_relaxed);
+	}
+	Sequential_Queue_MPMC(const Sequential_Queue_MPMC<ElementType, capcity> &other)
+		: Sequential_Queue_MPMC()
+	{
+		size_t rear = other.enqueue_position.load();
+		for (size_t position = other.dequeue_position.load(); position != rear; ++position)
+			Element_Enqueue(other.cells[position & mask].element[0]);
+	}
+	Sequential_Queue_MPMC<ElementType, capcity> &operator=(const Sequential_Queue_MPMC<ElementType, capcity> &) = delete;
+	~Sequential_Queue_MPMC() override
+	{
+		Clear();
+	}
+
+public:
+	bool Is_Empty() const override { return Get_Size() == 0; }
+	size_t Get_Size() const override
+	{
+		size_t front = dequeue_position.load(std::memory_order_acquire);
+		size_t rear = enqueue_position.load(std::memory_order_acquire);
+		return rear > front ? rear - front : 0; // 并发时两次读取之间可能有出队，避免回绕成很大的值
+	}
+	bool Is_Full() const { return Get_Size() >= capcity; }
+	constexpr size_t Get_Capcity() const { return capcity; }
+	// 清空队列，只析构有效元素
+	void Clear() override
+	{
+		while (_Dequeue([](ElementType &) {}))
+			;
+	}
+	ElementType &Get_Front() override
+	{
+		size_t position = dequeue_position.load(std::memory_order_relaxed);
+		Cell &cell = cells[position & mask];
+		if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+			throw std::runtime_error("Queue is Empty");
+		return cell.element[0];
+	}
+	void Queue_Show(const std::string &string = "") override
+	{
+		size_t front = dequeue_position.load(), rear = enqueue_position.load();
+		std::cout << string << std::endl
+				  << "[Size/Capcity]=[" << Get_Size() << '/' << capcity << ']' << std::endl
+				  << "[Front/Rear]=[" << (front & mask) << '/' << (rear & mask) << ']' << std::endl
+				  << "Queue-";
+		for (size_t position = front; position != rear; ++position)
+			std::cout << '[' << (position & mask) << ':' << cells[position & mask].element[0] << "]-";
+		std::cout << "End" << std::endl;
+	}
+
+public:
+	/// @brief 抢占下一个入队位置，该位置上一轮的元素还未出队(队满)时返回false
+	/// @note 拷贝入队先构造临时对象，队满时也会拷贝一次
+	bool Try_Enqueue(const ElementType &element) { return _Enqueue(ElementType(element)); }
+	bool Try_Enqueue(ElementType &&element) { return _Enqueue(std::move(element)); }
+	/// @brief 把队头元素移动到element并出队，队空时返回false
+	bool Try_Dequeue(ElementType &element)
+	{
+		return _Dequeue([&](ElementType &front) { element = std::move(front); });
+	}
+
+	void Element_Enqueue(const ElementType &element) override
+	{
+		if (!_Enqueue(ElementType(element)))
+			throw std::runtime_error("Enqueue Failed: Queue is Full");
+	}
+	void Element_Enqueue(ElementType &&element) override
+	{
+		if (!_Enqueue(std::move(element)))
+			throw std::runtime_error("Enqueue Failed: Queue is Full");
+	}
+	void Element_Dequeue() override
+	{
+		if (!_Dequeue([](ElementType &) {}))
+			throw std::runtime_error("Dequeue Failed: Queue is Empty");
+	}
+};
+
+#if __cplusplus >= 202002L
+static_assert(ADT::Linear_Queue<Sequential_Queue_MPMC<int, 8>, int>);
+#endif
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <atomic>
+#include <bit> //has_single_bit
+#include <iostream>
+#include <memory> //construct_at
+#include <stdexcept>
+
+#include "../Linear_Queue.hpp"
+#include "../../Concurrent_Container.hpp"
+#include "../../../Uninitialized_Array.hpp"
+
+/// ============================================================================================================
+/// 单生产者单消费者(SPSC)的无锁环形队列，用于两个线程之间传递消息
+/// - 容量为2的幂，下标用 & mask 代替 % capcity
+/// - head/tail只增不减，元素个数为tail-head；tail-head==capcity时队满，不需要多留一个空位或标志
+/// - 生产者只写tail，消费者只写head：元素写入后release存储tail，消费者acquire读取tail后才能读元素，反之亦然
+/// - 各线程缓存对方下标的上一次读取值，只有按缓存判断队满/队空时才重新读取对方的下标，减少缓存行在核间传递
+/// - 两组下标分别位于独立的缓存行，避免伪共享
+///
+/// 线程约定(通用部分见Concurrent_Container.hpp)
+/// - 只有一个生产者线程：Element_Enqueue/Try_Enqueue/Is_Full
+/// - 只有一个消费者线程：Get_Front/Element_Dequeue/Try_Dequeue；Get_Front的引用在本线程出队前一直有效
+/// - Clear会修改head，只能在没有其他线程访问时调用
+/// ============================================================================================================
+
+/// @tparam capcity 队列容量，必须是2的幂
+template <typename ElementType, size_t capcity>
+class Sequential_Queue_SPSC : public Logic::Queue<ElementType>
+{
+	static_assert(std::has_single_bit(capcity), "Queue Init Failed: capcity must be a power of 2");
+	static constexpr size_t mask = capcity - 1;
+	static constexpr size_t cache_line = 64;
+
+private:
+	alignas(cache_line) std::atomic<size_t> head{}; // 队头，消费者写，生产者读
+	size_t tail_cached{};							// 消费者缓存的tail
+	alignas(cache_line) std::atomic<size_t> tail{}; // 队尾(待插入位置)，生产者写，消费者读
+	size_t head_cached{};							// 生产者缓存的head
+	alignas(cache_line) Uninitialized_Array<ElementType, capcity> array; // 只有[head,tail)环形区间内的位置构造了元素
+
+private:
+	/// 生产者：按缓存的head判断队满，队满时重新读取head
+	bool _Has_Space(size_t tail_current)
+	{
+		if (tail_current - head_cached < capcity)
+			return true;
+		head_cached = head.load(std::memory_order_acquire); // 与消费者出队时的release配对，旧元素已经析构
+		return tail_current - head_cached < capcity;
+	}
+	/// 消费者：按缓存的tail判断队空，队空时重新读取tail
+	bool _Has_Element(size_t head_current)
+	{
+		if (head_current != tail_cached)
+			return true;
+		tail_cached = tail.load(std::memory_order_acquire); // 与生产者入队时的release配对，新元素已经构造
+		return head_current != tail_cached;
+	}
+	template <typename Element>
+	bool _Enqueue(Element &&element)
+	{
+		size_t tail_current = tail.load(std::memory_order_relaxed);
+		if (!_Has_Space(tail_current))
+			return false;
+		std::construct_at(array.Data() + (tail_current & mask), std::forward<Element>(element));
+		tail.store(tail_current + 1, std::memory_order_release);
+		return true;
+	}
+
+protected:
+	ElementType &Get_Rear() override
+	{
+		size_t tail_current = tail.load(std::memory_order_relaxed);
+		if (tail_current == head.load(std::memory_order_acquire))
+			throw std::runtime_error("Queue is Empty");
+		return array[(tail_current - 1) & mask];
+	}
+
+public:
+	Sequential_Queue_SPSC() = default;
+	Sequential_Queue_SPSC(const Sequential_Queue_SPSC<ElementType, capcity> &other)
+		: Logic::Queue<ElementType>()
+	{
+		for (size_t index = other.head.load(); index != other.tail.load(); ++index)
+			Element_Enqueue(other.array[index & mask]);
+	}
+	Sequential_Queue_SPSC<ElementType, capcity> &operator=(const Sequential_Queue_SPSC<ElementType, capcity> &) = delete;
+	~Sequential_Queue_SPSC() override
+	{
+		Clear();
+	}
+
+public:
+	bool Is_Empty() const override { return Get_Size() == 0; }
+	size_t Get_Size() const override
+	{
+		size_t head_current = head.load(std::memory_order_acquire);
+		return tail.load(std::memory_order_acquire) - head_current;
+	}
+	bool Is_Full() const { return Get_Size() == capcity; }
+	constexpr size_t Get_Capcity() const { return capcity; }
+	// 清空队列，只析构有效元素
+	void Clear() override
+	{
+		size_t tail_current = tail.load(std::memory_order_relaxed);
+		for (size_t index = head.load(std::memory_order_relaxed); index != tail_current; ++index)
+			std::destroy_at(array.Data() + (index & mask));
+		head.store(tail_current, std::memory_order_relaxed);
+		head_cached = tail_cached = tail_current;
+	}
+	ElementType &Get_Front() override
+	{
+		size_t head_current = head.load(std::memory_order_relaxed);
+		if (!_Has_Element(head_current))
+			throw std::runtime_error("Queue is Empty");
+		return array[head_current & mask];
+	}
+	void Queue_Show(const std::string &string = "") override
+	{
+		std::cout << string << std::endl
+				  << "[Size/Capcity]=[" << Get_Size() << '/' << capcity << ']' << std::endl
+				  << "[Head/Tail]=[" << (head.load() & mask) << '/' << (tail.load() & mask) << ']' << std::endl
+				  << "Queue-";
+		for (size_t index = head.load(); index != tail.load(); ++index)
+			std::cout << '[' << (index & mask) << ':' << array[index & mask] << "]-";
+		std::cout << "End" << std::endl;
+	}
+
+public:
+	/// @brief 生产者入队，队满时返回false
+	bool Try_Enqueue(const ElementType &element) { return _Enqueue(element); }
+	bool Try_Enqueue(ElementType &&element) { return _Enqueue(std::move(element)); }
+	/// @brief 把队头元素移动到element并出队，队空时返回false
+	bool Try_Dequeue(ElementType &element)
+	{
+		size_t head_current = head.load(std::memory_order_relaxed);
+		if (!_Has_Element(head_current))
+			return false;
+		ElementType *front = array.Data() + (head_current & mask);
+		element = std::move(*front);
+		std::destroy_at(front);
+		head.store(head_current + 1, std::memory_order_release);
+		return true;
+	}
+
+	void Element_Enqueue(const ElementType &element) override
+	{
+		if (!_Enqueue(element))
+			throw std::runtime_error("Enqueue Failed: Queue is Full");
+	}
+	void Element_Enqueue(ElementType &&element) override
+	{
+		if (!_Enqueue(std::move(element)))
+			throw std::runtime_error("Enqueue Failed: Queue is Full");
+	}
+	void Element_Dequeue() override
+	{
+		size_t head_current = head.load(std::memory_order_relaxed);
+		if (!_Has_Element(head_current))
+			throw std::runtime_error("Dequeue Failed: Queue is Empty");
+		std::destroy_at(array.Data() + (head_current & mask));
+		head.store(head_current + 1, std::memory_order_release);
+	}
+};
+
+#if __cplusplus >= 202002L
+static_assert(ADT::Linear_Queue<Sequential_Queue_SPSC<int, 8>, int>);
+#endif
@@ -4,15 +4,18 @@
 
 #include "../Stack.hpp"
 #include "../../List_Node.hpp"
+#include "../../List_Node_Allocator.hpp"
 
 namespace Storage
 {
 	/// @brief 头插法实现的链栈，top指向首元节点
-	template <typename ElementType, typename NodeType = List_Node_SingleWay<ElementType>>
+	/// @tparam AllocatorPolicy 节点分配策略，见List_Node_Allocator.hpp
+	template <typename ElementType, typename NodeType = List_Node_SingleWay<ElementType>, typename AllocatorPolicy = Policy::Node_New>
 	class Link_Stack : public Logic::Stack<ElementType>
 	{
 	protected:
 		NodeType *top{nullptr};
+		typename AllocatorPolicy::template Allocator<NodeType> allocator{}; // 节点分配器
 
 	public: /// 对象维护头节点，存放栈信息
 		Link_Stack() = default;
@@ -28,12 +31,9 @@ namespace Storage
 		/// 由于链栈空间利用率高，不存在空节点，所以清空链表元素==销毁所有链表节点
 		void Clear() override
 		{
-			while (top)
-			{
-				NodeType *del = top;
-				top = top->next;
-				delete del;
-			}
+			allocator.Release(top);
+			top = nullptr;
+			this->size = 0;
 		}
 		// 返回栈顶元素
 		ElementType &Get_Top() override
@@ -56,12 +56,12 @@ namespace Storage
 		// 元素入栈
 		virtual void Element_Push(const ElementType &element) override
 		{
-			top = new NodeType(element, top);
+			top = allocator.Allocate(element, top);
 			++this->size;
 		}
 		virtual void Element_Push(ElementType &&element) override
 		{
-			top = new NodeType(std::move(element), top);
+			top = allocator.Allocate(std::move(element), top);
 			++this->size;
 		}
 		// 元素出栈
@@ -71,7 +71,7 @@ namespace Storage
 				throw std::runtime_error("Stack is empty");
 			NodeType *node = top;
 			top = top->next;
-			delete node;
+			allocator.Deallocate(node);
 			--this->size;
 		}
 		// 更新节点元素值
@@ -81,10 +81,33 @@ namespace Storage
 /// @brief 同Storage::Link_Stack的实现，此处仅添加拷贝控制
 /// @tparam ElementType
 /// @tparam NodeType
-template <typename ElementType, typename NodeType = List_Node_SingleWay<ElementType>>
-class Link_Stack : public Storage::Link_Stack<ElementType, NodeType>
+/// @tparam AllocatorPolicy 节点分配策略
+template <typename ElementType, typename NodeType = List_Node_SingleWay<ElementType>, typename AllocatorPolicy = Policy::Node_New>
+class Link_Stack : public Storage::Link_Stack<ElementType, NodeType, AllocatorPolicy>
 {
 private:
+	// 按other从栈顶到栈底的顺序，将元素拷贝到当前空栈
+	void _Copy_Elements(const Link_Stack &other)
+	{
+		NodeType *self{};
+		for (NodeType *node = other.top; node; node = node->next)
+		{
+			NodeType *copy = this->allocator.Allocate(node->element);
+			(self ? self->next : this->top) = copy;
+			self = copy;
+			++this->size;
+		}
+	}
+	// 接管other的所有节点和分配器
+	void _Move_Elements(Link_Stack &other)
+	{
+		this->top = other.top;
+		this->size = other.size;
+		this->allocator = std::move(other.allocator);
+		other.top = nullptr;
+		other.size = 0;
+	}
+
 public:
 	Link_Stack() = default;
 
@@ -92,79 +115,27 @@ public:
 	{
 		if (this == &other)
 			throw std::logic_error("Self Coppied");
-		if (other.size == 0)
-			return;
-		else if (other.size == 1)
-			this->Element_Push(other.top->element);
-		else
-		{
-			//处理首元节点
-			this->top = new NodeType(other.top->element);
-			++this->size;
-			NodeType *node = other.top, *self = this->top;
-			//统一处理后续节点
-			while (node->next)
-			{
-				self->next = new NodeType(node->next->element);
-				self = self->next;
-				node = node->next;
-				++this->size;
-			}
-
-		}
+		_Copy_Elements(other);
 	}
 	Link_Stack &operator=(const Link_Stack &other)
 	{
-		this->size = 0;
 		if (this == &other)
 			throw std::logic_error("Self Coppied");
-		if (other.size == 0)
-			return Link_Stack{};
-		else if (other.size == 1)
-			Element_Push(other.top->element);
-		else
-		{
-			// 处理首元节点
-			this->top = new NodeType(other.top->element);
-			++this->size;
-			NodeType *node = other.top, *self = this->top;
-			// 统一处理后续节点
-			while (node->next)
-			{
-				self->next = new NodeType(node->next->element);
-				self = self->next;
-				node = node->next;
-				++this->size;
-			}
-		}
-		
+		this->Clear();
+		_Copy_Elements(other);
 		return *this;
 	}
 
 	Link_Stack(Link_Stack &&other)
 	{
-		this->top = other.top;
-		other.top = nullptr;
-		other.size = 0;
-		auto node = this->top;
-		while (node)
-		{
-			++this->size;
-			node = node->next;
-		}
+		_Move_Elements(other);
 	}
 	Link_Stack &operator=(Link_Stack &&other)
 	{
-		this->top = other.top;
-		other.top = nullptr;
-		other.size = 0;
-		auto node = this->top;
-		while (node)
-		{
-			++this->size;
-			node = node->next;
-		}
+		if (this == &other)
+			throw std::logic_error("Self Coppied");
+		this->Clear();
+		_Move_Elements(other);
 		return *this;
 	}
-
-};
\ No newline at end of file
+};
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+
+#include "../Stack.hpp"
+#include "../../Concurrent_Container.hpp"
+#include "../../List_Node.hpp"
+#include "../../List_Node_Allocator.hpp"
+#include "../../Memory_Reclamation.hpp"
+
+/// ============================================================================================================
+/// 无锁链栈，Treiber《Systems Programming: Coping with Parallelism》
+/// - top指向栈顶节点，入栈：新节点的next指向读到的top，CAS把top换成新节点
+/// - 出栈：读top和top->next，CAS把top换成next，成功的线程独占出栈的节点
+/// - 节点沿用List_Node_SingleWay，next通过std::atomic_ref原子访问
+///
+/// ABA与内存回收
+/// - 出栈的节点如果立即释放并被复用后重新入栈，另一个线程持有的旧top与之相等，CAS会用过期的next错误地成功(ABA)
+/// - 访问top前进入Reclamation::Epoch_Domain，出栈的节点交给回收域，所有可能持有它的线程离开后才回到空闲链表，
+///   因此CAS比较的节点在本线程读取之后不会被复用，不需要带版本号的指针(双字CAS)
+/// - 回收后的节点进入默认的Policy::Node_Thread_Cache，之后的入栈从线程缓存中取得节点，不经过new/delete
+///
+/// 线程约定(通用部分见Concurrent_Container.hpp)
+/// - Element_Push/Element_Pop/Try_Pop/Clear 可以在任意多个线程中同时调用
+/// - Get_Size在遍历时进入回收域，可以与出栈并发调用，结果是近似值
+/// - ElementType需要可以默认构造(出栈时重置元素)
+/// ============================================================================================================
+
+namespace Storage
+{
+	/// @tparam AllocatorPolicy 节点分配策略。出栈的节点可能在其他线程推进纪元时释放，所以要求node_transferable
+	template <typename ElementType, typename AllocatorPolicy = Policy::Node_Thread_Cache<>>
+	class Link_Stack_Concurrent : public Logic::Stack<ElementType>
+	{
+	public:
+		using NodeType = List_Node_SingleWay<ElementType>;
+
+	private:
+		static_assert(AllocatorPolicy::node_transferable, "Link_Stack_Concurrent: nodes are freed by the reclamation domain and must not belong to the stack");
+		static_assert(std::atomic_ref<NodeType *>::required_alignment <= alignof(NodeType *), "Link_Stack_Concurrent: next can not be accessed atomically");
+		using Allocator = typename AllocatorPolicy::template Allocator<NodeType>;
+
+		std::atomic<NodeType *> top{nullptr};
+		[[no_unique_address]] Allocator allocator{};
+
+	private:
+		static std::atomic_ref<NodeType *> _Next(NodeType *node) { return std::atomic_ref<NodeType *>(node->next); }
+		static void _Node_Free(void *node) { Allocator{}.Deallocate(static_cast<NodeType *>(node)); }
+
+		void _Push(NodeType *node)
+		{ // 新节点还未发布，不需要进入回收域
+			NodeType *first = top.load(std::memory_order_relaxed);
+			do
+				_Next(node).store(first, std::memory_order_relaxed);
+			// release：其他线程从top读到节点时，能看到构造好的元素和next
+			while (!top.compare_exchange_weak(first, node, std::memory_order_release, std::memory_order_relaxed));
+		}
+		/// 摘下栈顶节点，对它的元素调用consume，栈空时返回false
+		template <typename Consume>
+		bool _Pop(Consume &&consume)
+		{
+			auto guard = Reclamation::Epoch_Domain::Global().Pin();
+			NodeType *first = top.load(std::memory_order_acquire);
+			while (first)
+			{ // first在guard期间不会被回收，读取next是安全的；CAS成功说明first仍是栈顶，next没有过期
+				NodeType *next = _Next(first).load(std::memory_order_relaxed);
+				if (top.compare_exchange_weak(first, next, std::memory_order_acquire, std::memory_order_acquire))
+				{
+					consume(first->element);
+					Reclamation::Epoch_Domain::Global().Retire(first, _Node_Free);
+					return true;
+				}
+			}
+			return false;
+		}
+
+	public:
+		Link_Stack_Concurrent() = default;
+		/// 按other从栈顶到栈底的顺序拷贝节点并链接到末尾，保持元素顺序
+		Link_Stack_Concurrent(const Link_Stack_Concurrent &other) : Logic::Stack<ElementType>()
+		{
+			NodeType *self{};
+			try
+			{
+				for (NodeType *node = other.top.load(); node; node = node->next)
+				{
+					NodeType *copy = allocator.Allocate(node->element);
+					if (self)
+						self->next = copy;
+					else
+						top.store(copy, std::memory_order_relaxed);
+					self = copy;
+				}
+			}
+			catch (...) // 构造函数抛出时不调用析构函数，回收已拷贝的节点
+			{
+				allocator.Release(top.load(std::memory_order_relaxed));
+				throw;
+			}
+		}
+		Link_Stack_Concurrent &operator=(const Link_Stack_Concurrent &) = delete;
+		/// 析构时没有其他线程访问，剩余节点直接回收
+		~Link_Stack_Concurrent() override
+		{
+			allocator.Release(top.load(std::memory_order_acquire));
+		}
+
+	public:
+		bool Is_Empty() const override { return top.load(std::memory_order_acquire) == nullptr; }
+		/// @note 遍历计数，O(n)。每次入栈出栈都在top上CAS，计数器会在第二个原子变量上增加一次竞争的写
+		size_t Get_Size() const override
+		{
+			auto guard = Reclamation::Epoch_Domain::Global().Pin();
+			size_t count{};
+			for (NodeType *node = top.load(std::memory_order_acquire); node; node = _Next(node).load(std::memory_order_acquire))
+				++count;
+			return count;
+		}
+		// 清空栈：逐个出栈，可以与其他线程并发调用
+		void Clear() override
+		{
+			while (_Pop(Discard_Element<ElementType>))
+				;
+		}
+		ElementType &Get_Top() override
+		{
+			NodeType *first = top.load(std::memory_order_acquire);
+			if (!first)
+				throw std::runtime_error("Stack is empty");
+			return first->element;
+		}
+		void Stack_Show(const std::string &string = "") override
+		{
+			std::cout << string << std::endl
+					  << "[Size]:" << Get_Size() << std::endl
+					  << "Top=>";
+			size_t index{1};
+			for (NodeType *node = top.load(); node; node = node->next, ++index)
+				std::cout << '[' << index << ':' << node->element << "]->";
+			std::cout << "Bottom(NULL)" << std::endl;
+		}
+
+	public:
+		void Element_Push(const ElementType &element) override { _Push(allocator.Allocate(element)); }
+		void Element_Push(ElementType &&element) override { _Push(allocator.Allocate(std::move(element))); }
+		void Element_Pop() override
+		{
+			if (!_Pop(Discard_Element<ElementType>))
+				throw std::runtime_error("Stack is empty");
+		}
+		/// @brief 把栈顶元素移动到element并出栈，栈空时返回false
+		bool Try_Pop(ElementType &element)
+		{
+			return _Pop([&](ElementType &top_element) { element = std::move(top_element); });
+		}
+	};
+}
+
+template <typename ElementType, typename AllocatorPolicy = Policy::Node_Thread_Cache<>>
+using Link_Stack_Concurrent = Storage::Link_Stack_Concurrent<ElementType, AllocatorPolicy>;
+
+#if __cplusplus >= 202002L
+static_assert(ADT::Linear_Stack<Link_Stack_Concurrent<int>, int>);
+#endif
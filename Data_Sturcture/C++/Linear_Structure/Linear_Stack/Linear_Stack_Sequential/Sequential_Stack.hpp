@@ -1,9 +1,10 @@
 #pragma once
 
 #include <iostream>
-#include <cstring> //memset
+#include <memory> //construct_at
 
 #include "../Stack.hpp"
+#include "../../../Uninitialized_Array.hpp"
 
 /// ============================================================================================================
 /// 		 四种类型：满增栈、满减栈、空增栈、空减栈。
@@ -19,6 +20,7 @@
 /// 以下的实现中
 /// 1. 空增栈、空减栈申请maxsize个元素的栈空间，注意栈满时top=top_max,指向非法的越界空间
 /// 2. 满增栈、满减栈申请maxsize+1个元素的栈空间，冗余的一个元素空间用于初始时指向top_min位置
+/// 3. 栈空间为未初始化内存，入栈时原地构造元素，出栈时析构元素，空闲位置不构造对象
 /// ============================================================================================================
 
 namespace Storage
@@ -33,25 +35,35 @@ namespace Storage
 
 	protected:
 		virtual void _Top_Reset() { top = top_min; }
+		// 栈底元素(位置最小的有效元素)的下标，有效元素为[_Bottom_Index(),_Bottom_Index()+size)
+		virtual size_t _Bottom_Index() const = 0;
+
+		// 在未初始化的storage中拷贝构造other的有效元素，调用前top和size已与other一致
+		void _Copy_Elements(const Sequential_Stack<ElementType> &other)
+		{
+			std::uninitialized_copy_n(other.storage + other._Bottom_Index(), other.size, storage + other._Bottom_Index());
+		}
+		// 在未初始化的storage中移动构造other的有效元素，并析构other的元素使其为空栈
+		void _Move_Elements(Sequential_Stack<ElementType> &other)
+		{
+			std::uninitialized_move_n(other.storage + other._Bottom_Index(), other.size, storage + other._Bottom_Index());
+			other.Clear();
+		}
 
 	public:
 		Sequential_Stack(ElementType *storage, size_t top_min)
-			: top{top_min}, top_min{top_min},storage{storage} {}
+			: top{top_min}, top_min{top_min}, storage{storage} {}
+		/// 拷贝控制只复制top和size，元素由派生类在storage指向自身数组后复制
 		Sequential_Stack(const Storage::Sequential_Stack<ElementType> &other)
 			: Logic::Stack<ElementType>(other.size), top{other.top}, top_min{other.top_min} {}
 		Sequential_Stack(Sequential_Stack<ElementType> &&other)
-			: Logic::Stack<ElementType>(other.size), top{other.top}, top_min{other.top_min}
-		{
-			other.size = 0;
-			other._Top_Reset();
-		}
+			: Logic::Stack<ElementType>(other.size), top{other.top}, top_min{other.top_min} {}
 		Sequential_Stack &operator=(const Sequential_Stack<ElementType> &other)
 		{
 			if (this == &other)
 				throw std::logic_error("Self Copied");
 			this->size = other.size;
 			top = other.top;
-			top_min = other.top_min;
 			return *this;
 		}
 		Sequential_Stack &operator=(Sequential_Stack<ElementType> &&other)
@@ -59,10 +71,7 @@ namespace Storage
 			if (this == &other)
 				throw std::logic_error("Self Copied");
 			this->size = other.size;
-			other.size = 0;
 			top = other.top;
-			top_min = other.top_min;
-			other._Top_Reset();
 			return *this;
 		}
 
@@ -70,11 +79,12 @@ namespace Storage
 		virtual ~Sequential_Stack() = default;
 
 	public: /// 栈操作
-		// 清空栈
+		// 清空栈，只析构有效元素
 		virtual void Clear()
 		{
-			while (!this->Is_Empty())
-				this->Element_Pop();
+			std::destroy_n(storage + _Bottom_Index(), this->size);
+			this->size = 0;
+			_Top_Reset();
 		}
 		constexpr virtual size_t Get_Capcity() const = 0;
 		// 返回栈顶元素
@@ -100,32 +110,30 @@ namespace Storage
 /// ============================================================================================================
 
 /// @brief 空增栈：Push=top++
-/// @note top∈[0,maxsize-1]
+/// @note top∈[0,maxsize],有效区间=[0,top)
 template <typename ElementType, size_t maxsize>
 class Sequential_Stack_Empty_Ascending : public Storage::Sequential_Stack<ElementType>
 {
 protected:
-	ElementType array[maxsize]{};
+	Uninitialized_Array<ElementType, maxsize> array;
+
+protected:
+	size_t _Bottom_Index() const override { return 0; }
 
 public:
 	Sequential_Stack_Empty_Ascending()
-		: Storage::Sequential_Stack<ElementType>(array, 0) {}
+		: Storage::Sequential_Stack<ElementType>(array.Data(), 0) {}
 	Sequential_Stack_Empty_Ascending(const Sequential_Stack_Empty_Ascending<ElementType, maxsize> &other)
 		: Storage::Sequential_Stack<ElementType>(other)
 	{
-		this->storage = array;
-		for (size_t i = 0; i < Get_Capcity(); i++)
-			array[i] = other.array[i];
+		this->storage = array.Data();
+		this->_Copy_Elements(other);
 	}
 	Sequential_Stack_Empty_Ascending(Sequential_Stack_Empty_Ascending<ElementType, maxsize> &&other)
 		: Storage::Sequential_Stack<ElementType>(std::forward<Sequential_Stack_Empty_Ascending<ElementType, maxsize> &&>(other))
 	{
-		this->storage = array;
-		for (size_t i = 0; i < Get_Capcity(); i++)
-		{
-			array[i] = std::move(other.array[i]);
-			other.array[i] = ElementType{};
-		}
+		this->storage = array.Data();
+		this->_Move_Elements(other);
 	}
 	Sequential_Stack_Empty_Ascending &
 	operator=(const Sequential_Stack_Empty_Ascending<ElementType, maxsize> &other)
@@ -133,11 +141,9 @@ public:
 		if (this == &other)
 			throw std::logic_error("Self Copied");
 
-		this->storage = array;
+		this->Clear();
 		Storage::Sequential_Stack<ElementType>::operator=(other);
-
-		for (size_t i = 0; i < Get_Capcity(); i++)
-			array[i] = other.array[i];
+		this->_Copy_Elements(other);
 
 		return *this;
 	}
@@ -147,17 +153,16 @@ public:
 		if (this == &other)
 			throw std::logic_error("Self Copied");
 
-		this->storage = array;
-		Storage::Sequential_Stack<ElementType>::operator=(other);
-
-		for (size_t i = 0; i < Get_Capcity(); i++)
-		{
-			array[i] = std::move(other.array[i]);
-			other.array[i] = ElementType{};
-		}
+		this->Clear();
+		Storage::Sequential_Stack<ElementType>::operator=(std::move(other));
+		this->_Move_Elements(other);
 
 		return *this;
 	}
+	~Sequential_Stack_Empty_Ascending()
+	{
+		this->Clear();
+	}
 
 public: /// 栈操作
 	constexpr size_t Get_Capcity() const override { return maxsize; }
@@ -175,14 +180,14 @@ public: /// 元素操作
 	{
 		if (this->size >= maxsize)
 			throw std::out_of_range("Stack is full");
-		this->array[this->top++] = element;
+		std::construct_at(array.Data() + this->top++, element);
 		++this->size;
 	}
 	virtual void Element_Push(ElementType &&element) override
 	{
 		if (this->size >= maxsize)
 			throw std::out_of_range("Stack is full");
-		this->array[this->top++] = std::move(element);
+		std::construct_at(array.Data() + this->top++, std::move(element));
 		++this->size;
 	}
 	// 元素出栈
@@ -190,20 +195,25 @@ public: /// 元素操作
 	{
 		if (this->Is_Empty())
 			throw std::out_of_range("Stack is Empty");
-		array[--this->top] = ElementType{};
+		std::destroy_at(array.Data() + --this->top);
 		--this->size;
 	}
 
 public:
-	// 输出栈所有信息
+	// 输出栈所有信息，空闲位置没有构造元素，只输出下标
 	virtual void Stack_Show(const std::string &string = "") override
 	{
 		std::cout << string << std::endl
 				  << "[Size/Maxsize]:\n"
 				  << " [" << this->Get_Size() << '/' << maxsize << ']' << std::endl
 				  << "Bottom-";
-		for (size_t index = 0; index < maxsize; index++)
-			std::cout << '[' << index << ':' << array[index] << "]-";
+		for (size_t index = 0; index < this->Get_Capcity(); index++)
+		{
+			std::cout << '[' << index << ':';
+			if (index >= _Bottom_Index() && index < _Bottom_Index() + this->size)
+				std::cout << array[index];
+			std::cout << "]-";
+		}
 		std::cout << "TOP[" << this->top << ']' << std::endl;
 	}
 };
@@ -214,27 +224,25 @@ template <typename ElementType, size_t maxsize>
 class Sequential_Stack_Full_Ascending : public Storage::Sequential_Stack<ElementType>
 {
 protected:
-	ElementType array[maxsize + 1]{};
+	Uninitialized_Array<ElementType, maxsize + 1> array;
+
+protected:
+	size_t _Bottom_Index() const override { return 1; }
 
 public:
 	Sequential_Stack_Full_Ascending()
-		: Storage::Sequential_Stack<ElementType>(array, 0) {}
+		: Storage::Sequential_Stack<ElementType>(array.Data(), 0) {}
 	Sequential_Stack_Full_Ascending(const Sequential_Stack_Full_Ascending<ElementType, maxsize> &other)
 		: Storage::Sequential_Stack<ElementType>(other)
 	{
-		this->storage = array;
-		for (size_t i = 0; i < Get_Capcity(); i++)
-			array[i] = other.array[i];
+		this->storage = array.Data();
+		this->_Copy_Elements(other);
 	}
 	Sequential_Stack_Full_Ascending(Sequential_Stack_Full_Ascending<ElementType, maxsize> &&other)
 		: Storage::Sequential_Stack<ElementType>(std::forward<Sequential_Stack_Full_Ascending<ElementType, maxsize> &&>(other))
 	{
-		this->storage = array;
-		for (size_t i = 0; i < Get_Capcity(); i++)
-		{
-			array[i] = std::move(other.array[i]);
-			other.array[i] = ElementType{};
-		}
+		this->storage = array.Data();
+		this->_Move_Elements(other);
 	}
 	Sequential_Stack_Full_Ascending &
 	operator=(const Sequential_Stack_Full_Ascending<ElementType, maxsize> &other)
@@ -242,11 +250,9 @@ public:
 		if (this == &other)
 			throw std::logic_error("Self Copied");
 
-		this->storage = array;
+		this->Clear();
 		Storage::Sequential_Stack<ElementType>::operator=(other);
-
-		for (size_t i = 0; i < Get_Capcity(); i++)
-			array[i] = other.array[i];
+		this->_Copy_Elements(other);
 
 		return *this;
 	}
@@ -256,17 +262,16 @@ public:
 		if (this == &other)
 			throw std::logic_error("Self Copied");
 
-		this->storage = array;
-		Storage::Sequential_Stack<ElementType>::operator=(other);
-
-		for (size_t i = 0; i < Get_Capcity(); i++)
-		{
-			array[i] = std::move(other.array[i]);
-			other.array[i] = ElementType{};
-		}
+		this->Clear();
+		Storage::Sequential_Stack<ElementType>::operator=(std::move(other));
+		this->_Move_Elements(other);
 
 		return *this;
 	}
+	~Sequential_Stack_Full_Ascending()
+	{
+		this->Clear();
+	}
 
 public: /// 栈操作
 	constexpr size_t Get_Capcity() const override { return maxsize + 1; }
@@ -284,14 +289,14 @@ public: /// 元素操作
 	{
 		if (this->size >= maxsize)
 			throw std::out_of_range("Stack is full");
-		this->array[++this->top] = element;
+		std::construct_at(array.Data() + ++this->top, element);
 		++this->size;
 	}
 	virtual void Element_Push(ElementType &&element) override
 	{
 		if (this->size >= maxsize)
 			throw std::out_of_range("Stack is full");
-		this->array[++this->top] = std::move(element);
+		std::construct_at(array.Data() + ++this->top, std::move(element));
 		++this->size;
 	}
 	// 元素出栈
@@ -299,12 +304,12 @@ public: /// 元素操作
 	{
 		if (this->Is_Empty())
 			throw std::out_of_range("Stack is Empty");
-		array[this->top--] = ElementType{};
+		std::destroy_at(array.Data() + this->top--);
 		--this->size;
 	}
 
 public:
-	// 输出栈所有信息
+	// 输出栈所有信息，空闲位置没有构造元素，只输出下标
 	virtual void Stack_Show(const std::string &string = "") override
 	{
 		std::cout << string << std::endl
@@ -312,41 +317,44 @@ public:
 				  << " [" << this->Get_Size() << '/' << maxsize << ']' << std::endl
 				  << "Bottom-";
 		for (size_t index = 0; index < this->Get_Capcity(); index++)
-			std::cout << '[' << index << ':' << array[index] << "]-";
+		{
+			std::cout << '[' << index << ':';
+			if (index >= _Bottom_Index() && index < _Bottom_Index() + this->size)
+				std::cout << array[index];
+			std::cout << "]-";
+		}
 		std::cout << "TOP[" << this->top << ']' << std::endl;
 	}
 };
 
-/// @brief 空减栈：top=maxsize,Push=top
-/// @note top∈[0,maxsize]
+/// @brief 空减栈：top=maxsize-1,Push=top--
+/// @note top∈[-1,maxsize-1],有效区间=(top,maxsize-1]
 template <typename ElementType, size_t maxsize>
 class Sequential_Stack_Empty_Descending : public Storage::Sequential_Stack<ElementType>
 {
 protected:
-	ElementType array[maxsize]{};
+	Uninitialized_Array<ElementType, maxsize> array;
 
 private:
 	void _Top_Reset() override { this->top = maxsize - 1; }
 
+protected:
+	size_t _Bottom_Index() const override { return this->top + 1; }
+
 public:
 	Sequential_Stack_Empty_Descending()
-		: Storage::Sequential_Stack<ElementType>(array, maxsize - 1) {}
+		: Storage::Sequential_Stack<ElementType>(array.Data(), maxsize - 1) {}
 	Sequential_Stack_Empty_Descending(const Sequential_Stack_Empty_Descending<ElementType, maxsize> &other)
 		: Storage::Sequential_Stack<ElementType>(other)
 	{
-		this->storage = array;
-		for (size_t i = 0; i < Get_Capcity(); i++)
-			array[i] = other.array[i];
+		this->storage = array.Data();
+		this->_Copy_Elements(other);
 	}
 	Sequential_Stack_Empty_Descending(Sequential_Stack_Empty_Descending<ElementType, maxsize> &&other)
 		: Storage::Sequential_Stack<ElementType>(std::forward<Sequential_Stack_Empty_Descending<ElementType, maxsize> &&>(other))
 	{
-		this->storage = array;
-		for (size_t i = 0; i < Get_Capcity(); i++)
-		{
-			array[i] = std::move(other.array[i]);
-			other.array[i] = ElementType{};
-		}
+		this->storage = array.Data();
+		this->_Move_Elements(other);
 	}
 	Sequential_Stack_Empty_Descending &
 	operator=(const Sequential_Stack_Empty_Descending<ElementType, maxsize> &other)
@@ -354,11 +362,9 @@ public:
 		if (this == &other)
 			throw std::logic_error("Self Copied");
 
-		this->storage = array;
+		this->Clear();
 		Storage::Sequential_Stack<ElementType>::operator=(other);
-
-		for (size_t i = 0; i < Get_Capcity(); i++)
-			array[i] = other.array[i];
+		this->_Copy_Elements(other);
 
 		return *this;
 	}
@@ -368,17 +374,16 @@ public:
 		if (this == &other)
 			throw std::logic_error("Self Copied");
 
-		this->storage = array;
-		Storage::Sequential_Stack<ElementType>::operator=(other);
-
-		for (size_t i = 0; i < Get_Capcity(); i++)
-		{
-			array[i] = std::move(other.array[i]);
-			other.array[i] = ElementType{};
-		}
+		this->Clear();
+		Storage::Sequential_Stack<ElementType>::operator=(std::move(other));
+		this->_Move_Elements(other);
 
 		return *this;
 	}
+	~Sequential_Stack_Empty_Descending()
+	{
+		this->Clear();
+	}
 
 public: /// 栈操作
 	constexpr size_t Get_Capcity() const override { return maxsize; }
@@ -396,14 +401,14 @@ public: /// 元素操作
 	{
 		if (this->size >= maxsize)
 			throw std::out_of_range("Stack is full");
-		this->array[this->top--] = element;
+		std::construct_at(array.Data() + this->top--, element);
 		++this->size;
 	}
 	virtual void Element_Push(ElementType &&element) override
 	{
 		if (this->size >= maxsize)
 			throw std::out_of_range("Stack is full");
-		this->array[this->top--] = std::move(element);
+		std::construct_at(array.Data() + this->top--, std::move(element));
 		++this->size;
 	}
 	// 元素出栈
@@ -411,12 +416,12 @@ public: /// 元素操作
 	{
 		if (this->Is_Empty())
 			throw std::out_of_range("Stack is Empty");
-		array[++this->top] = ElementType{};
+		std::destroy_at(array.Data() + ++this->top);
 		--this->size;
 	}
 
 public:
-	// 输出栈所有信息
+	// 输出栈所有信息，空闲位置没有构造元素，只输出下标
 	virtual void Stack_Show(const std::string &string = "") override
 	{
 		std::cout << string << std::endl
@@ -424,41 +429,44 @@ public:
 				  << " [" << this->Get_Size() << '/' << maxsize << ']' << std::endl
 				  << "Bottom-";
 		for (size_t index = 0; index < this->Get_Capcity(); index++)
-			std::cout << '[' << index << ':' << array[index] << "]-";
+		{
+			std::cout << '[' << index << ':';
+			if (index >= _Bottom_Index() && index < _Bottom_Index() + this->size)
+				std::cout << array[index];
+			std::cout << "]-";
+		}
 		std::cout << "TOP[" << this->top << ']' << std::endl;
 	}
 };
 
-/// @brief 满减栈：top=0,Push=++top
-/// @note top∈[0,maxsize]
+/// @brief 满减栈：top=maxsize,Push=--top
+/// @note top∈[0,maxsize],有效区间=[top,maxsize)
 template <typename ElementType, size_t maxsize>
 class Sequential_Stack_Full_Descending : public Storage::Sequential_Stack<ElementType>
 {
 protected:
-	ElementType array[maxsize + 1]{};
+	Uninitialized_Array<ElementType, maxsize + 1> array;
 
 private:
 	void _Top_Reset() override { this->top = maxsize; }
 
+protected:
+	size_t _Bottom_Index() const override { return this->top; }
+
 public:
 	Sequential_Stack_Full_Descending()
-		: Storage::Sequential_Stack<ElementType>(array, maxsize) {}
+		: Storage::Sequential_Stack<ElementType>(array.Data(), maxsize) {}
 	Sequential_Stack_Full_Descending(const Sequential_Stack_Full_Descending<ElementType, maxsize> &other)
 		: Storage::Sequential_Stack<ElementType>(other)
 	{
-		this->storage = array;
-		for (size_t i = 0; i < Get_Capcity(); i++)
-			array[i] = other.array[i];
+		this->storage = array.Data();
+		this->_Copy_Elements(other);
 	}
 	Sequential_Stack_Full_Descending(Sequential_Stack_Full_Descending<ElementType, maxsize> &&other)
 		: Storage::Sequential_Stack<ElementType>(std::forward<Sequential_Stack_Full_Descending<ElementType, maxsize> &&>(other))
 	{
-		this->storage = array;
-		for (size_t i = 0; i < Get_Capcity(); i++)
-		{
-			array[i] = std::move(other.array[i]);
-			other.array[i] = ElementType{};
-		}
+		this->storage = array.Data();
+		this->_Move_Elements(other);
 	}
 	Sequential_Stack_Full_Descending &
 	operator=(const Sequential_Stack_Full_Descending<ElementType, maxsize> &other)
@@ -466,11 +474,9 @@ public:
 		if (this == &other)
 			throw std::logic_error("Self Copied");
 
-		this->storage = array;
+		this->Clear();
 		Storage::Sequential_Stack<ElementType>::operator=(other);
-
-		for (size_t i = 0; i < Get_Capcity(); i++)
-			array[i] = other.array[i];
+		this->_Copy_Elements(other);
 
 		return *this;
 	}
@@ -480,17 +486,16 @@ public:
 		if (this == &other)
 			throw std::logic_error("Self Copied");
 
-		this->storage = array;
-		Storage::Sequential_Stack<ElementType>::operator=(other);
-
-		for (size_t i = 0; i < Get_Capcity(); i++)
-		{
-			array[i] = std::move(other.array[i]);
-			other.array[i] = ElementType{};
-		}
+		this->Clear();
+		Storage::Sequential_Stack<ElementType>::operator=(std::move(other));
+		this->_Move_Elements(other);
 
 		return *this;
 	}
+	~Sequential_Stack_Full_Descending()
+	{
+		this->Clear();
+	}
 
 public: /// 栈操作
 	constexpr size_t Get_Capcity() const override { return maxsize + 1; }
@@ -508,14 +513,14 @@ public: /// 元素操作
 	{
 		if (this->size >= maxsize)
 			throw std::out_of_range("Stack is full");
-		this->array[--this->top] = element;
+		std::construct_at(array.Data() + --this->top, element);
 		++this->size;
 	}
 	virtual void Element_Push(ElementType &&element) override
 	{
 		if (this->size >= maxsize)
 			throw std::out_of_range("Stack is full");
-		this->array[--this->top] = std::move(element);
+		std::construct_at(array.Data() + --this->top, std::move(element));
 		++this->size;
 	}
 	// 元素出栈
@@ -523,12 +528,12 @@ public: /// 元素操作
 	{
 		if (this->Is_Empty())
 			throw std::out_of_range("Stack is Empty");
-		array[this->top++] = ElementType{};
+		std::destroy_at(array.Data() + this->top++);
 		--this->size;
 	}
 
 public:
-	// 输出栈所有信息
+	// 输出栈所有信息，空闲位置没有构造元素，只输出下标
 	virtual void Stack_Show(const std::string &string = "") override
 	{
 		std::cout << string << std::endl
@@ -536,7 +541,12 @@ public:
 				  << " [" << this->Get_Size() << '/' << maxsize << ']' << std::endl
 				  << "Bottom-";
 		for (size_t index = 0; index < this->Get_Capcity(); index++)
-			std::cout << '[' << index << ':' << array[index] << "]-";
+		{
+			std::cout << '[' << index << ':';
+			if (index >= _Bottom_Index() && index < _Bottom_Index() + this->size)
+				std::cout << array[index];
+			std::cout << "]-";
+		}
 		std::cout << "TOP[" << this->top << ']' << std::endl;
 	}
 };
@@ -22,7 +22,7 @@ namespace Logic
 		// 清空栈
 		virtual void Clear() = 0;
 		// 判断是否栈空
-		bool Is_Empty() const { return size == 0; }
+		virtual bool Is_Empty() const { return size == 0; }
 		// 返回栈长度(元素个数)
 		virtual size_t Get_Size() const { return size; }
 		// 返回栈顶元素
@@ -1,6 +1,11 @@
 #pragma once
 #include <iostream>
+#include <algorithm> //fill_n
+#include <atomic>
+#include <cstdint>   //uintptr_t
+#include <memory> //destroy_n
 #include "../Node.hpp"
+#include "../Uninitialized_Array.hpp"
 
 
 /// ============================================================================================================
@@ -222,3 +227,86 @@ struct List_Node_Skiplist:public Node<ElementType>
 		delete[] next;
 	}
 };
+
+/// @brief 单次分配的跳表节点：指针数组(塔)紧跟在节点之后，与元素位于同一块内存
+/// @note 与redis zskiplistNode的柔性数组相同，next声明为1个元素，实际分配level+1个元素
+/// 跨度数组紧跟在指针数组之后：Span(i)为沿第i层从本节点到next[i]在第0层经过的节点数，用于按排名访问
+/// 节点大小随层数变化，不能直接new，必须由分配器按Bytes(level)申请内存后构造
+template <typename ElementType>
+struct List_Node_Skiplist_Inline : public Node<ElementType>
+{
+	// ElementType element{};
+	size_t level{};								   // 当前节点的最高层数
+	List_Node_Skiplist_Inline<ElementType> *next[1]; // 指针数组。node->next[level]，必须放在最后
+
+	/// @brief 最高层为level的节点需要的字节数
+	static constexpr size_t Bytes(size_t level)
+	{
+		return sizeof(List_Node_Skiplist_Inline<ElementType>) + level * sizeof(next[0]) + (level + 1) * sizeof(size_t);
+	}
+	size_t &Span(size_t index) { return reinterpret_cast<size_t *>(next + level + 1)[index]; }
+	size_t Span(size_t index) const { return reinterpret_cast<const size_t *>(next + level + 1)[index]; }
+
+	// 构造函数，调用前需已分配Bytes(level)字节
+	List_Node_Skiplist_Inline(const ElementType &element, size_t level)
+		: Node<ElementType>{element}, level{level} { _Tower_Clear(); }
+	List_Node_Skiplist_Inline(ElementType &&element, size_t level)
+		: Node<ElementType>{std::forward<ElementType>(element)}, level{level} { _Tower_Clear(); }
+	// 节点大小不固定，不能拷贝或移动
+	List_Node_Skiplist_Inline(const List_Node_Skiplist_Inline<ElementType> &) = delete;
+	List_Node_Skiplist_Inline<ElementType> &operator=(const List_Node_Skiplist_Inline<ElementType> &) = delete;
+
+private:
+	void _Tower_Clear()
+	{
+		std::fill_n(next, level + 1, nullptr);
+		std::fill_n(&Span(0), level + 1, 0);
+	}
+};
+
+/// @brief 并发跳表的节点：与List_Node_Skiplist_Inline相同，指针数组紧跟在节点之后一次分配
+/// next[i]保存带标记的指针，最低位为删除标记：置位表示节点已被逻辑删除，第i层的后继不再改变
+/// @note 元素在插入后不再修改，其他线程可以不加锁读取
+template <typename ElementType>
+struct List_Node_Skiplist_Concurrent : public Node<ElementType>
+{
+	// ElementType element{};
+	size_t level{};						// 当前节点的最高层数
+	std::atomic<uint8_t> references{2}; // 插入线程和删除线程各持有一个引用，都释放后节点才能回收
+	std::atomic<uintptr_t> next[1];		// 带标记的指针数组。node->next[level]，必须放在最后
+
+	/// @brief 最高层为level的节点需要的字节数
+	static constexpr size_t Bytes(size_t level) { return sizeof(List_Node_Skiplist_Concurrent<ElementType>) + level * sizeof(next[0]); }
+
+	// 构造函数，调用前需已分配Bytes(level)字节
+	List_Node_Skiplist_Concurrent(const ElementType &element, size_t level)
+		: Node<ElementType>{element}, level{level}, next{0}
+	{
+		for (size_t i = 1; i <= level; ++i)
+			std::construct_at(next + i, 0);
+	}
+	// 节点大小不固定，不能拷贝或移动
+	List_Node_Skiplist_Concurrent(const List_Node_Skiplist_Concurrent<ElementType> &) = delete;
+	List_Node_Skiplist_Concurrent<ElementType> &operator=(const List_Node_Skiplist_Concurrent<ElementType> &) = delete;
+};
+
+/// @brief 展开链表的节点：一个节点连续存放最多capacity个元素
+/// @tparam capacity 每个节点的元素容量
+/// @note 只有elements[0,count)构造了元素，由链表负责构造和移动元素；节点析构时析构现有元素
+template <typename ElementType, size_t capacity>
+struct List_Node_Unrolled
+{
+	Uninitialized_Array<ElementType, capacity> elements;
+	size_t count{}; // 当前节点的元素个数
+	List_Node_Unrolled<ElementType, capacity> *pre{};
+	List_Node_Unrolled<ElementType, capacity> *next{};
+
+	List_Node_Unrolled() = default;
+	// 元素由链表逐个拷贝，节点本身不可拷贝
+	List_Node_Unrolled(const List_Node_Unrolled<ElementType, capacity> &) = delete;
+	List_Node_Unrolled<ElementType, capacity> &operator=(const List_Node_Unrolled<ElementType, capacity> &) = delete;
+	~List_Node_Unrolled()
+	{
+		std::destroy_n(elements.Data(), count);
+	}
+};
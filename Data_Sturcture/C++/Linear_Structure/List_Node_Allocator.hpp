@@ -0,0 +1,405 @@
+#pragma once
+
+#include <atomic>	   //atomic_flag
+#include <cstddef>	   //std::byte
+#include <memory>	   //construct_at
+#include <new>		   //align_val_t
+#include <thread>	   //yield
+#include <type_traits> //is_trivially_destructible
+#include <utility>	   //exchange
+
+/// ============================================================================================================
+/// 链式结构的节点分配策略，作为Link_List/Link_Queue/Link_Stack的模板参数
+/// 每个策略提供 template <typename NodeType> Allocator，接口为：
+/// 		NodeType *Allocate(args...)	构造一个节点
+/// 		void Deallocate(NodeType *)	析构并回收一个节点
+/// 		void Release(NodeType *first)	析构并回收从first开始沿next链接的所有节点(用于清空容器)
+/// 分配器属于容器自身：拷贝容器时新容器使用自己的空池，移动容器时节点连同池一起转移
+/// 策略的 static constexpr bool node_transferable 表示节点能否在两个容器之间转移(Splice/Merge)
+/// ============================================================================================================
+namespace Policy
+{
+	/// @brief 每个节点单独new/delete
+	struct Node_New
+	{
+		static constexpr bool node_transferable = true; // 节点不属于任何池，可以直接链接到另一个容器
+		template <typename NodeType>
+		struct Allocator
+		{
+			template <typename... Args>
+			NodeType *Allocate(Args &&...args) { return new NodeType(std::forward<Args>(args)...); }
+			void Deallocate(NodeType *node) { delete node; }
+			void Release(NodeType *first)
+			{
+				while (first)
+					delete std::exchange(first, first->next);
+			}
+		};
+	};
+
+	/// @brief 节点池：每次向系统申请slab_count个节点的slab，回收的节点挂在空闲链表上复用
+	/// @tparam slab_count 每个slab的节点个数
+	/// @note Release时不逐个回收节点，析构元素(平凡析构时跳过遍历)后整体释放所有slab
+	template <size_t slab_count = 64>
+	struct Node_Pool
+	{
+		static_assert(slab_count > 0, "Node_Pool: slab_count must be greater than 0");
+		static constexpr bool node_transferable = false; // 节点位于所属容器的slab中，随该容器一起释放
+
+		template <typename NodeType>
+		class Allocator
+		{
+		private:
+			union Slot
+			{ // 空闲时存放下一个空闲槽，分配后存放节点
+				Slot *next;
+				alignas(NodeType) std::byte node[sizeof(NodeType)];
+			};
+			struct Slab
+			{
+				Slab *next;
+				Slot slots[slab_count];
+			};
+
+			Slab *slabs{};			 // 所有slab的链表，表头为最新的slab
+			Slot *free_list{};		 // 回收的空闲槽
+			size_t used{slab_count}; // 最新slab中已经分配过的槽数，等于slab_count时需要新的slab
+
+		private:
+			Slot *_Slot_Acquire()
+			{
+				if (free_list)
+					return std::exchange(free_list, free_list->next);
+				if (used == slab_count)
+				{
+					Slab *slab = new Slab;
+					slab->next = slabs;
+					slabs = slab;
+					used = 0;
+				}
+				return &slabs->slots[used++];
+			}
+			void _Slot_Recycle(Slot *slot)
+			{
+				slot->next = free_list;
+				free_list = slot;
+			}
+			void _Slabs_Free()
+			{
+				while (slabs)
+					delete std::exchange(slabs, slabs->next);
+				free_list = nullptr;
+				used = slab_count;
+			}
+
+		public:
+			Allocator() = default;
+			/// 池不共享，拷贝得到一个空池
+			Allocator(const Allocator &) {}
+			Allocator &operator=(const Allocator &) { return *this; }
+			Allocator(Allocator &&other) noexcept
+				: slabs{std::exchange(other.slabs, nullptr)},
+				  free_list{std::exchange(other.free_list, nullptr)},
+				  used{std::exchange(other.used, slab_count)} {}
+			/// 调用前容器需已Release自己的节点
+			Allocator &operator=(Allocator &&other) noexcept
+			{
+				if (this == &other)
+					return *this;
+				_Slabs_Free();
+				slabs = std::exchange(other.slabs, nullptr);
+				free_list = std::exchange(other.free_list, nullptr);
+				used = std::exchange(other.used, slab_count);
+				return *this;
+			}
+			~Allocator() { _Slabs_Free(); }
+
+		public:
+			template <typename... Args>
+			NodeType *Allocate(Args &&...args)
+			{
+				Slot *slot = _Slot_Acquire();
+				try
+				{
+					return std::construct_at(reinterpret_cast<NodeType *>(slot->node), std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					_Slot_Recycle(slot);
+					throw;
+				}
+			}
+			void Deallocate(NodeType *node)
+			{
+				std::destroy_at(node);
+				_Slot_Recycle(reinterpret_cast<Slot *>(node));
+			}
+			void Release(NodeType *first)
+			{
+				if constexpr (!std::is_trivially_destructible_v<NodeType>)
+					while (first)
+						std::destroy_at(std::exchange(first, first->next));
+				_Slabs_Free();
+			}
+		};
+	};
+
+	/// @brief 线程缓存：回收的节点放入当前线程的空闲链表，之后本线程的分配优先复用
+	/// 	线程缓存满cache_limit个时整批交给全局仓库，缓存为空的线程从仓库取一整批
+	/// 	生产者分配、消费者回收的流水线中，节点经仓库从消费者回到生产者，每批只加锁一次
+	/// @tparam cache_limit 每批的节点数，也是每个线程为每种NodeType缓存的最多节点数
+	/// @note 空闲链表属于线程而不属于容器，可以在任意线程中回收任意容器的节点，
+	/// 	适合无锁结构：节点由回收域在安全后、在某个线程中释放，此时所属容器可能已经析构
+	/// 	仓库中的批在进程结束时释放，仓库的大小不超过同时存在的节点数的峰值
+	template <size_t cache_limit = 256>
+	struct Node_Thread_Cache
+	{
+		static_assert(cache_limit > 0, "Node_Thread_Cache: cache_limit must be greater than 0");
+		static constexpr bool node_transferable = true; // 节点不属于任何容器
+
+		template <typename NodeType>
+		struct Allocator
+		{
+		private:
+			union Slot
+			{ // 空闲时存放链接，分配后存放节点
+				struct Link
+				{
+					Slot *next;	 // 同一批中的下一个空闲槽
+					Slot *batch; // 仓库中下一批的第一个槽
+				} link;
+				alignas(NodeType) std::byte node[sizeof(NodeType)];
+			};
+			/// 缓存和仓库都是平凡析构的，线程/进程的析构阶段之后仍然可以访问，closed之后不再缓存
+			struct Cache
+			{
+				Slot *free_list;
+				size_t count;
+				bool closed;
+			};
+			struct Depot
+			{
+				std::atomic_flag lock;
+				Slot *batches;
+				bool closed;
+			};
+			/// 线程退出时释放线程缓存的槽
+			struct Cache_Flusher
+			{
+				~Cache_Flusher()
+				{
+					_Batch_Free(std::exchange(cache.free_list, nullptr));
+					cache.count = 0;
+					cache.closed = true;
+				}
+			};
+			/// 进程结束时释放仓库中的批
+			struct Depot_Flusher
+			{
+				~Depot_Flusher()
+				{
+					_Depot_Lock();
+					for (Slot *batch = depot.batches; batch;)
+						_Batch_Free(std::exchange(batch, batch->link.batch));
+					depot.batches = nullptr;
+					depot.closed = true;
+					depot.lock.clear(std::memory_order_release);
+				}
+			};
+			static inline thread_local Cache cache{};
+			static inline Depot depot{};
+
+		private:
+			static void _Slot_Free(Slot *slot) { ::operator delete(slot, std::align_val_t{alignof(Slot)}); }
+			static void _Batch_Free(Slot *first)
+			{
+				while (first)
+					_Slot_Free(std::exchange(first, first->link.next));
+			}
+			/// 第一次使用线程缓存时注册线程退出时的释放
+			static Cache &_Cache()
+			{
+				[[maybe_unused]] thread_local Cache_Flusher flusher;
+				return cache;
+			}
+			static void _Depot_Lock()
+			{
+				while (depot.lock.test_and_set(std::memory_order_acquire))
+					std::this_thread::yield();
+			}
+			static void _Depot_Push(Slot *batch)
+			{
+				[[maybe_unused]] static Depot_Flusher flusher;
+				_Depot_Lock();
+				if (depot.closed)
+					_Batch_Free(batch);
+				else
+				{
+					batch->link.batch = depot.batches;
+					depot.batches = batch;
+				}
+				depot.lock.clear(std::memory_order_release);
+			}
+			static Slot *_Depot_Pop()
+			{
+				_Depot_Lock();
+				Slot *batch = depot.batches;
+				if (batch)
+					depot.batches = batch->link.batch;
+				depot.lock.clear(std::memory_order_release);
+				return batch;
+			}
+			static Slot *_Slot_Acquire()
+			{
+				if (!cache.closed)
+				{
+					Cache &local = _Cache();
+					if (!local.free_list && (local.free_list = _Depot_Pop()))
+						local.count = cache_limit;
+					if (local.free_list)
+					{
+						--local.count;
+						return std::exchange(local.free_list, local.free_list->link.next);
+					}
+				}
+				return static_cast<Slot *>(::operator new(sizeof(Slot), std::align_val_t{alignof(Slot)}));
+			}
+			static void _Slot_Recycle(Slot *slot)
+			{
+				if (cache.closed)
+					return _Slot_Free(slot);
+				Cache &local = _Cache();
+				slot->link.next = local.free_list;
+				local.free_list = slot;
+				if (++local.count == cache_limit)
+				{
+					_Depot_Push(std::exchange(local.free_list, nullptr));
+					local.count = 0;
+				}
+			}
+
+		public:
+			template <typename... Args>
+			static NodeType *Allocate(Args &&...args)
+			{
+				Slot *slot = _Slot_Acquire();
+				try
+				{
+					return std::construct_at(reinterpret_cast<NodeType *>(slot->node), std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					_Slot_Recycle(slot);
+					throw;
+				}
+			}
+			static void Deallocate(NodeType *node)
+			{
+				std::destroy_at(node);
+				_Slot_Recycle(reinterpret_cast<Slot *>(node));
+			}
+			static void Release(NodeType *first)
+			{
+				while (first)
+					Deallocate(std::exchange(first, first->next));
+			}
+		};
+	};
+
+	/// ============================================================================================================
+	/// 变长节点的分配策略，如跳表节点：节点尾部的数组长度由size_class决定，Bytes不同的节点不能共用槽
+	/// 提供 template <typename NodeType, size_t class_count> Allocator，接口为：
+	/// 		NodeType *Allocate(size_class, args...)		按NodeType::Bytes(size_class)分配内存并构造节点
+	/// 		void Deallocate(NodeType *, size_class)		析构并回收一个节点
+	/// 节点之间的链接方式由容器决定，容器析构时先析构剩余节点，分配器析构时整体释放内存
+	/// ============================================================================================================
+
+	/// @brief 按大小分级的节点池：所有级别共用slab顺序切分，每个级别有自己的空闲链表
+	/// @tparam slab_bytes 每个slab的字节数，必须能放下最大级别的节点
+	/// @note 回收的节点只会被同一级别复用。比起每个节点单独new，省去了分配器的块头和每次分配的开销，节点在内存中也更紧凑
+	template <size_t slab_bytes = 16384>
+	struct Node_Pool_Sized
+	{
+		static constexpr bool node_transferable = false;
+
+		template <typename NodeType, size_t class_count>
+		class Allocator
+		{
+		private:
+			struct Slot
+			{ // 空闲槽的前几个字节存放同一级别的下一个空闲槽
+				Slot *next;
+			};
+			struct Slab
+			{
+				Slab *next;
+				alignas(NodeType) alignas(Slot) std::byte bytes[slab_bytes];
+			};
+			static constexpr size_t alignment = alignof(NodeType) > alignof(Slot) ? alignof(NodeType) : alignof(Slot);
+			/// 级别为size_class的槽的字节数，按alignment向上取整，保证顺序切分的槽都是对齐的
+			static constexpr size_t _Slot_Bytes(size_t size_class)
+			{
+				size_t bytes = NodeType::Bytes(size_class) > sizeof(Slot) ? NodeType::Bytes(size_class) : sizeof(Slot);
+				return (bytes + alignment - 1) / alignment * alignment;
+			}
+			static_assert(class_count > 0, "Node_Pool_Sized: class_count must be greater than 0");
+			static_assert(_Slot_Bytes(class_count - 1) <= slab_bytes, "Node_Pool_Sized: slab_bytes is too small for the largest node");
+
+			Slab *slabs{};					  // 所有slab的链表，表头为最新的slab
+			Slot *free_lists[class_count]{};  // 每个级别回收的空闲槽
+			size_t used{slab_bytes};		  // 最新slab中已经切分出去的字节数
+
+		private:
+			std::byte *_Slot_Acquire(size_t size_class)
+			{
+				if (Slot *&free_list = free_lists[size_class]; free_list)
+					return reinterpret_cast<std::byte *>(std::exchange(free_list, free_list->next));
+				size_t bytes = _Slot_Bytes(size_class);
+				if (used + bytes > slab_bytes) // 最新slab剩余的空间不够，剩余部分直接丢弃
+				{
+					Slab *slab = new Slab;
+					slab->next = slabs;
+					slabs = slab;
+					used = 0;
+				}
+				return slabs->bytes + std::exchange(used, used + bytes);
+			}
+			void _Slot_Recycle(void *memory, size_t size_class)
+			{
+				free_lists[size_class] = std::construct_at(static_cast<Slot *>(memory), Slot{free_lists[size_class]});
+			}
+
+		public:
+			Allocator() = default;
+			/// 节点由容器逐个链接，池不能拷贝
+			Allocator(const Allocator &) = delete;
+			Allocator &operator=(const Allocator &) = delete;
+			~Allocator()
+			{
+				while (slabs)
+					delete std::exchange(slabs, slabs->next);
+			}
+
+		public:
+			template <typename... Args>
+			NodeType *Allocate(size_t size_class, Args &&...args)
+			{
+				std::byte *memory = _Slot_Acquire(size_class);
+				try
+				{
+					return std::construct_at(reinterpret_cast<NodeType *>(memory), std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					_Slot_Recycle(memory, size_class);
+					throw;
+				}
+			}
+			void Deallocate(NodeType *node, size_t size_class)
+			{
+				std::destroy_at(node);
+				_Slot_Recycle(node, size_class);
+			}
+		};
+	};
+}
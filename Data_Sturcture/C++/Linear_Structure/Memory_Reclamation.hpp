@@ -0,0 +1,182 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility> //exchange
+#include <vector>
+
+/// ============================================================================================================
+/// 无锁结构的内存回收：基于纪元(epoch)的回收，Fraser《Practical lock-freedom》5.2.3
+/// 无锁结构中，节点从结构上摘除后，其他线程可能还持有它的指针，不能立即delete
+/// 		1. 访问共享节点前用Pin()得到Guard，Guard存在期间线程处于活跃状态，记录当时的全局纪元
+/// 		2. 摘除节点的线程调用Retire()，节点按当时的全局纪元e放入线程自己的回收袋
+/// 		3. 所有活跃线程都记录了当前纪元e时，全局纪元才能推进到e+1
+/// 		   全局纪元到达e+2时，摘除前进入的Guard都已退出，纪元e的回收袋可以释放
+/// 每个线程在第一次使用时获得一个线程记录，线程退出后记录(连同未释放的回收袋)留给之后的线程复用
+/// 进程结束时，全局域析构释放所有剩余的回收袋
+/// ============================================================================================================
+
+namespace Reclamation
+{
+	class Epoch_Domain
+	{
+	private:
+		struct Retired
+		{
+			void *object;
+			void (*deleter)(void *);
+		};
+		struct Bag
+		{
+			uint64_t epoch{};
+			std::vector<Retired> objects;
+		};
+		/// 线程记录，独占缓存行，避免线程之间伪共享
+		struct alignas(64) Record
+		{
+			std::atomic<uint64_t> epoch{}; // 活跃时为(纪元<<1)|1，不活跃时为0
+			std::atomic<bool> in_use{true};
+			Record *next{};
+			size_t depth{};		   // Guard的嵌套层数，只有最外层进入/退出时修改epoch
+			size_t retired_count{}; // 每回收advance_interval个对象尝试推进一次纪元
+			Bag bags[3];		   // 纪元e的对象放入bags[e%3]
+		};
+		/// 线程退出时释放线程记录
+		struct Handle
+		{
+			Record *record{};
+			~Handle()
+			{
+				if (record)
+					record->in_use.store(false, std::memory_order_release);
+			}
+		};
+
+		static constexpr size_t advance_interval = 64;
+
+		std::atomic<uint64_t> global_epoch{};
+		std::atomic<Record *> records{}; // 所有线程记录，只增加不删除
+
+	private:
+		Epoch_Domain() = default;
+		~Epoch_Domain()
+		{
+			for (Record *record = records.load(); record;)
+			{
+				for (Bag &bag : record->bags)
+					_Bag_Free(bag);
+				delete std::exchange(record, record->next);
+			}
+		}
+
+		static void _Bag_Free(Bag &bag)
+		{
+			for (Retired &retired : bag.objects)
+				retired.deleter(retired.object);
+			bag.objects.clear();
+		}
+
+		/// 当前线程的记录：复用已退出线程的记录，没有时新建一个插入表头
+		Record *_Record()
+		{
+			thread_local Handle handle;
+			if (handle.record)
+				return handle.record;
+			for (Record *record = records.load(std::memory_order_acquire); record; record = record->next)
+			{
+				bool in_use{};
+				if (!record->in_use.load(std::memory_order_relaxed) &&
+					record->in_use.compare_exchange_strong(in_use, true, std::memory_order_acquire))
+					return handle.record = record;
+			}
+			Record *record = new Record;
+			record->next = records.load(std::memory_order_relaxed);
+			while (!records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed))
+				;
+			return handle.record = record;
+		}
+
+		/// 所有活跃线程都已进入当前纪元时，全局纪元+1
+		void _Try_Advance()
+		{
+			uint64_t epoch = global_epoch.load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			for (Record *record = records.load(std::memory_order_acquire); record; record = record->next)
+			{
+				// acquire与Pin/Guard析构中的release配对：看到某个线程的新状态时，它之前对节点的读取都已完成
+				uint64_t local = record->epoch.load(std::memory_order_acquire);
+				if ((local & 1) && (local >> 1) != epoch)
+					return;
+			}
+			global_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel);
+		}
+
+		/// 释放当前线程中纪元不晚于全局纪元-2的回收袋
+		void _Collect(Record *record)
+		{
+			uint64_t epoch = global_epoch.load(std::memory_order_acquire);
+			for (Bag &bag : record->bags)
+				if (!bag.objects.empty() && bag.epoch + 2 <= epoch)
+					_Bag_Free(bag);
+		}
+
+	public:
+		Epoch_Domain(const Epoch_Domain &) = delete;
+		Epoch_Domain &operator=(const Epoch_Domain &) = delete;
+
+		/// @brief 进程内共享的回收域
+		static Epoch_Domain &Global()
+		{
+			static Epoch_Domain domain;
+			return domain;
+		}
+
+		/// @brief 线程的活跃区间，可以嵌套。Guard存在期间读到的共享节点不会被释放
+		class Guard
+		{
+			friend class Epoch_Domain;
+			Record *record{};
+			explicit Guard(Record *record) : record{record} {}
+
+		public:
+			Guard(const Guard &) = delete;
+			Guard &operator=(const Guard &) = delete;
+			~Guard()
+			{
+				if (--record->depth == 0)
+					record->epoch.store(0, std::memory_order_release);
+			}
+		};
+
+		[[nodiscard]] Guard Pin()
+		{
+			Record *record = _Record();
+			if (record->depth++ == 0)
+			{
+				record->epoch.store(global_epoch.load(std::memory_order_relaxed) << 1 | 1, std::memory_order_release);
+				std::atomic_thread_fence(std::memory_order_seq_cst); // 之后对共享节点的读取不能重排到进入活跃状态之前
+			}
+			return Guard{record};
+		}
+
+		/// @brief 回收一个已经从结构中摘除的对象，安全后调用deleter(object)
+		/// @note deleter在任意线程中调用，不能依赖所属容器仍然存在
+		void Retire(void *object, void (*deleter)(void *))
+		{
+			Record *record = _Record();
+			uint64_t epoch = global_epoch.load(std::memory_order_acquire);
+			Bag &bag = record->bags[epoch % 3];
+			if (bag.epoch != epoch) // 袋中对象的纪元不晚于epoch-3，已经安全
+			{
+				_Bag_Free(bag);
+				bag.epoch = epoch;
+			}
+			bag.objects.push_back({object, deleter});
+			if (++record->retired_count % advance_interval == 0)
+			{
+				_Try_Advance();
+				_Collect(record);
+			}
+		}
+	};
+}
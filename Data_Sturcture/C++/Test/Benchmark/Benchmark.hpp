@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+/// ============================================================================================================
+/// 性能测试的公共工具，每个性能测试文件可以单独编译执行
+/// 计时使用steady_clock，结果按 [名称][操作次数][总耗时][单次耗时] 输出为一行
+/// ============================================================================================================
+namespace Benchmark
+{
+	/// @brief 阻止编译器把没有副作用的计算结果优化掉
+	template <typename ValueType>
+	inline void Do_Not_Optimize(const ValueType &value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static volatile const void *sink;
+		sink = &value;
+#endif
+	}
+
+	/// @brief 执行一次function，返回耗时(纳秒)
+	template <typename Function>
+	double Measure(Function &&function)
+	{
+		auto start = std::chrono::steady_clock::now();
+		function();
+		auto end = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::nano>(end - start).count();
+	}
+
+	inline void Report_Header(std::string_view title)
+	{
+		std::cout << "\n========== " << title << " ==========\n"
+				  << std::left << std::setw(40) << "Case"
+				  << std::right << std::setw(14) << "Operations"
+				  << std::setw(14) << "Total(ms)"
+				  << std::setw(14) << "ns/op" << std::endl;
+	}
+
+	/// @brief 输出一行结果
+	/// @param operations 本次测量包含的操作次数，用于计算单次耗时
+	inline void Report(std::string_view name, size_t operations, double nanoseconds)
+	{
+		std::cout << std::left << std::setw(40) << name
+				  << std::right << std::setw(14) << operations
+				  << std::setw(14) << std::fixed << std::setprecision(3) << nanoseconds / 1e6
+				  << std::setw(14) << std::setprecision(2) << nanoseconds / (operations ? operations : 1)
+				  << std::endl;
+	}
+}
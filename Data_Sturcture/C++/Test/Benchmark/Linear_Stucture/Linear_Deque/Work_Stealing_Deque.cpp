@@ -0,0 +1,143 @@
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_Deque/Work_Stealing_Deque.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Work_Stealing_Deque.cpp -O2 -o Work_Stealing_Deque -std=c++20 -pthread
+// ./Work_Stealing_Deque
+
+/// ============================================================================================================
+/// 对比Work_Stealing_Deque与std::mutex保护的std::deque
+/// 1. 只有拥有者：每次入队一个int再从底部出队，没有竞争时的基本开销
+/// 2. 窃取吞吐：拥有者入队count个int(不出队)，thief_count个窃取者从顶部取走全部元素，ns/op为总耗时/count
+/// 3. 混合：拥有者每入队4个出队2个，窃取者同时窃取，ns/op为总耗时/count
+/// 线程数超过CPU核数时只反映竞争开销
+///
+/// 单核机器上的结果(ns/op)：
+/// 		只有拥有者            Chase-Lev 14.9              加锁 9.7~12.1
+/// 		窃取  1/2/4个窃取者   Chase-Lev 49~56/46~58/42~46  加锁 75/69~71/72~74
+/// 		混合  1/2/4个窃取者   Chase-Lev 30~33/29~33/30~33  加锁 66~67/64~76/66~69
+/// 		没有竞争时拥有者每次出队需要一次seq_cst栅栏(x86上为mfence)，比无争用的互斥锁慢；
+/// 		有窃取者时拥有者的入队和大部分出队不与窃取者争用，吞吐约为加锁的1.5~2倍。多核上需要重新测量
+/// ============================================================================================================
+
+constexpr int count = 2'000'000;
+
+struct Lock_Free
+{
+	Work_Stealing_Deque<int> deque;
+	void Push(int element) { deque.Element_Push(element); }
+	bool Try_Pop(int &element) { return deque.Try_Pop(element); }
+	bool Try_Steal(int &element) { return deque.Try_Steal(element); }
+};
+
+/// 加锁的std::deque：拥有者在尾部入队出队，窃取者从头部取
+struct Locked
+{
+	std::deque<int> deque;
+	std::mutex mutex;
+	void Push(int element)
+	{
+		std::lock_guard lock(mutex);
+		deque.push_back(element);
+	}
+	bool Try_Pop(int &element)
+	{
+		std::lock_guard lock(mutex);
+		if (deque.empty())
+			return false;
+		element = deque.back();
+		deque.pop_back();
+		return true;
+	}
+	bool Try_Steal(int &element)
+	{
+		std::lock_guard lock(mutex);
+		if (deque.empty())
+			return false;
+		element = deque.front();
+		deque.pop_front();
+		return true;
+	}
+};
+
+template <typename DequeType>
+void Owner_Only(const std::string &name)
+{
+	DequeType deque;
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		long long sum{};
+		int element{};
+		for (int i = 0; i < count; i++)
+		{
+			deque.Push(i);
+			if (deque.Try_Pop(element))
+				sum += element;
+		}
+		Benchmark::Do_Not_Optimize(sum);
+	});
+	Benchmark::Report(name + " owner push+pop", static_cast<size_t>(count) * 2, nanoseconds);
+}
+
+/// @param pop_every 拥有者每入队pop_every个元素，从底部出队pop_every/2个；为0时不出队
+template <typename DequeType>
+void Steal(const std::string &name, int thief_count, int pop_every)
+{
+	DequeType deque;
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		std::atomic<int> taken{};
+		std::vector<std::thread> thieves;
+		for (int id = 0; id < thief_count; id++)
+			thieves.emplace_back([&]()
+			{
+				long long sum{};
+				int element{};
+				while (taken.load(std::memory_order_relaxed) < count)
+				{
+					if (!deque.Try_Steal(element))
+					{
+						std::this_thread::yield();
+						continue;
+					}
+					taken.fetch_add(1, std::memory_order_relaxed);
+					sum += element;
+				}
+				Benchmark::Do_Not_Optimize(sum);
+			});
+		int element{};
+		for (int i = 0; i < count; i++)
+		{
+			deque.Push(i);
+			if (pop_every && i % pop_every == pop_every - 1)
+				for (int j = 0; j < pop_every / 2 && deque.Try_Pop(element); j++)
+					taken.fetch_add(1, std::memory_order_relaxed);
+		}
+		for (auto &thief : thieves)
+			thief.join();
+	});
+	Benchmark::Report(name + (pop_every ? " mixed" : " steal") + " thieves=" + std::to_string(thief_count), static_cast<size_t>(count), nanoseconds);
+}
+
+int main()
+{
+	Benchmark::Report_Header("owner only");
+	Owner_Only<Lock_Free>("Chase-Lev");
+	Owner_Only<Locked>("std::deque + mutex");
+	for (int pop_every : {0, 4})
+	{
+		Benchmark::Report_Header(pop_every ? "owner push/pop + thieves" : "owner push + thieves");
+		for (int thief_count : {1, 2, 4})
+		{
+			Steal<Lock_Free>("Chase-Lev", thief_count, pop_every);
+			Steal<Locked>("std::deque + mutex", thief_count, pop_every);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <string>
+
+#include "../../../../Linear_Structure/Linear_List/Link_List/Link_List.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Link_List.cpp -O2 -o Link_List -std=c++20
+// ./Link_List
+
+/// ============================================================================================================
+/// 对比节点分配策略：Policy::Node_New(每个节点new/delete) 与 Policy::Node_Pool(slab节点池)
+/// 1. 头插n个元素，再逐个头删：每次操作一次分配/回收
+/// 2. 头插n个元素，再List_Clear：节点池整体释放slab，不逐个回收节点
+/// 3. 按位序扫描 for pos in 1..n: list[pos]，游标缓存使单次访问与n无关；随机位序访问作为没有局部性时的对照
+/// 	迭代器遍历作为顺序访问的下限
+/// 4. 静态链表填满后反复头删+尾插：每次插入都从空闲列表分配一个位置，单次耗时应与maxsize无关
+/// 5. Sort：链表原地归并排序(只改链接)，对照拷贝到std::vector排序再写回
+/// ============================================================================================================
+
+template <typename ListType, typename ElementType>
+void Insert_Delete(const std::string &name, size_t count, const ElementType &element)
+{
+	ListType list;
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			list.Element_Insert(1, element);
+		for (size_t i = 0; i < count; i++)
+			list.Element_Delete(1);
+	});
+	Benchmark::Do_Not_Optimize(list.Get_Size());
+	Benchmark::Report(name + " insert+delete", count * 2, nanoseconds);
+}
+
+template <typename ListType, typename ElementType>
+void Insert_Clear(const std::string &name, size_t count, const ElementType &element, size_t rounds)
+{
+	ListType list;
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t round = 0; round < rounds; round++)
+		{
+			for (size_t i = 0; i < count; i++)
+				list.Element_Insert(1, element);
+			list.List_Clear();
+		}
+	});
+	Benchmark::Do_Not_Optimize(list.Get_Size());
+	Benchmark::Report(name + " insert+List_Clear", count * rounds, nanoseconds);
+}
+
+template <typename ElementType>
+void Suite(const std::string &type, const ElementType &element, size_t count)
+{
+	Benchmark::Report_Header("Link_List<" + type + "> n=" + std::to_string(count));
+	Insert_Delete<Link_List_Forward<ElementType>>("Forward new/delete", count, element);
+	Insert_Delete<Link_List_Forward<ElementType, Policy::Node_Pool<>>>("Forward Node_Pool", count, element);
+	Insert_Delete<Link_List_Double<ElementType>>("Double new/delete", count, element);
+	Insert_Delete<Link_List_Double<ElementType, Policy::Node_Pool<>>>("Double Node_Pool", count, element);
+
+	Insert_Clear<Link_List_Forward<ElementType>>("Forward new/delete", count, element, 10);
+	Insert_Clear<Link_List_Forward<ElementType, Policy::Node_Pool<>>>("Forward Node_Pool", count, element, 10);
+	Insert_Clear<Link_List_Double<ElementType>>("Double new/delete", count, element, 10);
+	Insert_Clear<Link_List_Double<ElementType, Policy::Node_Pool<>>>("Double Node_Pool", count, element, 10);
+}
+
+/// @param backward 单链表逆序扫描每次都从front出发(O(n^2))，仅在n较小时测量
+template <typename ListType>
+void Scan(const std::string &name, size_t count, bool backward)
+{
+	ListType list;
+	for (size_t i = 1; i <= count; i++)
+		list.Element_Insert(i, static_cast<int>(i));
+
+	long long sum{};
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t pos = 1; pos <= count; pos++)
+			sum += list[pos];
+	});
+	Benchmark::Report(name + " forward scan n=" + std::to_string(count), count, nanoseconds);
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		for (int element : list)
+			sum += element;
+	});
+	Benchmark::Report(name + " iterator scan n=" + std::to_string(count), count, nanoseconds);
+	if (backward)
+	{
+		nanoseconds = Benchmark::Measure([&]()
+		{
+			for (size_t pos = count; pos >= 1; pos--)
+				sum += list[pos];
+		});
+		Benchmark::Report(name + " backward scan n=" + std::to_string(count), count, nanoseconds);
+	}
+
+	size_t probes = 1000, pos = 1;
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t i = 0; i < probes; i++)
+		{
+			pos = (pos * 7919 + 13) % count + 1;
+			sum += list[pos];
+		}
+	});
+	Benchmark::Report(name + " random n=" + std::to_string(count), probes, nanoseconds);
+	Benchmark::Do_Not_Optimize(sum);
+}
+
+void Scan_Suite()
+{
+	Benchmark::Report_Header("Positional access operator[] with cursor");
+	for (size_t count = 1000; count <= 100'000; count *= 10)
+	{
+		Scan<Link_List_Forward<int>>("Forward", count, count <= 10'000);
+		Scan<Link_List_Double<int>>("Double", count, true);
+	}
+}
+
+template <size_t maxsize>
+void Static_Churn(size_t rounds)
+{
+	auto list = std::make_unique<Link_List_Static<int, maxsize>>(); // 存储在对象内部，避免占用栈空间
+	for (size_t i = 1; i <= maxsize; i++)
+		list->Element_Insert(i, static_cast<int>(i));
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t i = 0; i < rounds; i++)
+		{
+			list->Element_Delete(1);
+			list->Element_Insert(maxsize, static_cast<int>(i));
+		}
+	});
+	Benchmark::Do_Not_Optimize((*list)[1]);
+	Benchmark::Report("Static full delete+insert maxsize=" + std::to_string(maxsize), rounds * 2, nanoseconds);
+}
+
+void Static_Suite()
+{
+	Benchmark::Report_Header("Link_List_Static free list");
+	Static_Churn<1024>(1'000'000);
+	Static_Churn<16384>(1'000'000);
+	Static_Churn<262144>(1'000'000);
+}
+
+template <typename ListType>
+void Sort(const std::string &name, size_t count)
+{
+	ListType list, list_copy;
+	size_t seed = 1;
+	for (size_t i = 1; i <= count; i++)
+	{
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		list.Element_Insert(i, static_cast<int>(seed >> 33));
+	}
+	list_copy = list;
+	double nanoseconds = Benchmark::Measure([&]() { list.Sort(); });
+	Benchmark::Report(name + " Sort", count, nanoseconds);
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		std::vector<int> elements(list_copy.begin(), list_copy.end());
+		std::sort(elements.begin(), elements.end());
+		std::copy(elements.begin(), elements.end(), list_copy.begin());
+	});
+	Benchmark::Report(name + " copy+std::sort+copy back", count, nanoseconds);
+	Benchmark::Do_Not_Optimize(list[1] + list_copy[1]);
+}
+
+void Sort_Suite()
+{
+	for (size_t count : {10'000, 1'000'000})
+	{
+		Benchmark::Report_Header("Sort n=" + std::to_string(count));
+		Sort<Link_List_Forward<int>>("Forward", count);
+		Sort<Link_List_Double<int>>("Double", count);
+	}
+}
+
+int main()
+{
+	Static_Suite();
+	Scan_Suite();
+	Sort_Suite();
+	Suite<int>("int", 42, 1'000'000);
+	Suite<std::string>("std::string", std::string(32, 'x'), 1'000'000);
+	return 0;
+}
@@ -0,0 +1,99 @@
+#include <string>
+
+#include "../../../../Linear_Structure/Linear_List/Link_List/Link_List.hpp"
+#include "../../../../Linear_Structure/Linear_List/Link_List/Link_List_Unrolled.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Link_List_Unrolled.cpp -O2 -o Link_List_Unrolled -std=c++20
+// ./Link_List_Unrolled
+
+/// ============================================================================================================
+/// 对比展开链表Link_List_Unrolled(不同节点容量)与双向链表Link_List_Double
+/// 1. 扫描：迭代器遍历，以及按位序 for pos in 1..n: list[pos] (两者都有游标缓存)
+/// 2. 随机位序访问：没有局部性，展开链表每次跳过一整个节点
+/// 3. 随机位置插入n个元素，再随机位置删除到空：定位代价占主导，展开链表的定位步数约为双向链表的1/capacity
+/// ============================================================================================================
+
+template <typename ListType>
+void Scan(const std::string &name, size_t count)
+{
+	ListType list;
+	for (size_t i = 1; i <= count; i++)
+		list.Element_Insert(i, static_cast<int>(i));
+
+	long long sum{};
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (int element : list)
+			sum += element;
+	});
+	Benchmark::Report(name + " iterator scan", count, nanoseconds);
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t pos = 1; pos <= count; pos++)
+			sum += list[pos];
+	});
+	Benchmark::Report(name + " operator[] scan", count, nanoseconds);
+
+	size_t probes = 1000, pos = 1;
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t i = 0; i < probes; i++)
+		{
+			pos = (pos * 7919 + 13) % count + 1;
+			sum += list[pos];
+		}
+	});
+	Benchmark::Report(name + " random access", probes, nanoseconds);
+	Benchmark::Do_Not_Optimize(sum);
+}
+
+template <typename ListType>
+void Random_Insert_Delete(const std::string &name, size_t count)
+{
+	ListType list;
+	size_t seed = 1;
+	auto random = [&seed](size_t bound)
+	{ // 线性同余，避免<random>的开销计入
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		return (seed >> 33) % bound;
+	};
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			list.Element_Insert(random(list.Get_Size() + 1) + 1, static_cast<int>(i));
+	});
+	Benchmark::Report(name + " random insert", count, nanoseconds);
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		while (!list.Is_Empty())
+			list.Element_Delete(random(list.Get_Size()) + 1);
+	});
+	Benchmark::Report(name + " random delete", count, nanoseconds);
+}
+
+void Scan_Suite(size_t count)
+{
+	Benchmark::Report_Header("Scan n=" + std::to_string(count));
+	Scan<Link_List_Double<int>>("Double", count);
+	Scan<Link_List_Unrolled<int, 8>>("Unrolled<8>", count);
+	Scan<Link_List_Unrolled<int, 32>>("Unrolled<32>", count);
+	Scan<Link_List_Unrolled<int, 128>>("Unrolled<128>", count);
+}
+
+void Random_Insert_Delete_Suite(size_t count)
+{
+	Benchmark::Report_Header("Random insert/delete n=" + std::to_string(count));
+	Random_Insert_Delete<Link_List_Double<int>>("Double", count);
+	Random_Insert_Delete<Link_List_Unrolled<int, 8>>("Unrolled<8>", count);
+	Random_Insert_Delete<Link_List_Unrolled<int, 32>>("Unrolled<32>", count);
+	Random_Insert_Delete<Link_List_Unrolled<int, 128>>("Unrolled<128>", count);
+}
+
+int main()
+{
+	Scan_Suite(1'000'000);
+	Random_Insert_Delete_Suite(10'000);
+	Random_Insert_Delete_Suite(50'000);
+	return 0;
+}
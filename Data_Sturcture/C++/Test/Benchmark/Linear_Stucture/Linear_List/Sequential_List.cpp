@@ -0,0 +1,112 @@
+#include <string>
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_List/Sequential_List/Sequential_List.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Sequential_List.cpp -O2 -o Sequential_List -std=c++20
+// ./Sequential_List
+
+/// ============================================================================================================
+/// 1. 尾插n个元素的单次耗时应与n无关(均摊O(1))
+/// 对比不同的增长倍数，以及Reserve预留空间后不再扩展的情况
+/// 2. 在表中间插入/删除k个元素，逐个操作时尾部元素搬运k次，范围操作只搬运一次
+/// 3. 反复构造、拷贝、析构只有k个元素的小表：Sequential_List_Small在k不超过内部缓冲区时不申请堆空间
+/// ============================================================================================================
+
+template <typename ListType, typename ElementType>
+void Append(const std::string &name, size_t count, const ElementType &element, bool reserve = false)
+{
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		ListType list(1);
+		if (reserve)
+			list.Reserve(count);
+		for (size_t i = 1; i <= count; i++)
+			list.Element_Insert(i, element);
+		Benchmark::Do_Not_Optimize(list[count]);
+	});
+	Benchmark::Report(name + " n=" + std::to_string(count), count, nanoseconds);
+}
+
+template <typename ElementType>
+void Append_Suite(const std::string &type, const ElementType &element, size_t max_count)
+{
+	Benchmark::Report_Header("Append " + type);
+	for (size_t count = 1000; count <= max_count; count *= 10)
+	{
+		Append<Sequential_List_Dynamic<ElementType>>("factor 2", count, element);
+		Append<Sequential_List_Dynamic<ElementType, Policy::Growth_Geometric<1.5f>>>("factor 1.5", count, element);
+		Append<Sequential_List_Dynamic<ElementType>>("factor 2 + Reserve", count, element, true);
+	}
+}
+
+template <typename ElementType>
+void Splice_Suite(const std::string &type, const ElementType &element, size_t size, size_t count)
+{
+	Benchmark::Report_Header("Splice " + std::to_string(count) + " elements into middle of " + std::to_string(size) + " " + type);
+	std::vector<ElementType> block(count, element);
+	Sequential_List_Dynamic<ElementType> list(size + count);
+	for (size_t i = 1; i <= size; i++)
+		list.Element_Insert(i, element);
+
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			list.Element_Insert(size / 2 + i, block[i]);
+	});
+	Benchmark::Report("Element_Insert one by one", count, nanoseconds);
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			list.Element_Delete(size / 2);
+	});
+	Benchmark::Report("Element_Delete one by one", count, nanoseconds);
+
+	nanoseconds = Benchmark::Measure([&]()
+	{ list.Element_Insert(size / 2, block.begin(), block.end()); });
+	Benchmark::Report("Element_Insert range", count, nanoseconds);
+	nanoseconds = Benchmark::Measure([&]()
+	{ list.Element_Delete(size / 2, count); });
+	Benchmark::Report("Element_Delete range", count, nanoseconds);
+	Benchmark::Do_Not_Optimize(list[1]);
+}
+
+template <typename ListType>
+void Small(const std::string &name, size_t elements, size_t rounds)
+{
+	long long sum{};
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t round = 0; round < rounds; round++)
+		{
+			ListType list;
+			for (size_t i = 1; i <= elements; i++)
+				list.Element_Insert(i, static_cast<int>(i + round));
+			ListType copy{list};
+			sum += copy[elements];
+		}
+	});
+	Benchmark::Do_Not_Optimize(sum);
+	Benchmark::Report(name + " k=" + std::to_string(elements), rounds, nanoseconds);
+}
+
+void Small_Suite(size_t rounds)
+{
+	Benchmark::Report_Header("Construct+insert k+copy small lists (ns per list)");
+	for (size_t elements : {4, 16, 64})
+	{
+		Small<Sequential_List_Dynamic<int>>("Dynamic", elements, rounds);
+		Small<Sequential_List_Small<int, 16>>("Small<16>", elements, rounds);
+	}
+}
+
+int main()
+{
+	Small_Suite(1'000'000);
+	Append_Suite<int>("int (memcpy relocation)", 42, 10'000'000);
+	Append_Suite<std::string>("std::string (move relocation)", std::string(32, 'x'), 1'000'000);
+	Splice_Suite<int>("int", 42, 1'000'000, 1000);
+	Splice_Suite<std::string>("std::string", std::string(32, 'x'), 100'000, 1000);
+	return 0;
+}
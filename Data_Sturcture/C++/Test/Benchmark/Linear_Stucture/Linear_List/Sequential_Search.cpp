@@ -0,0 +1,69 @@
+#include <string>
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_List/Sequential_List/Sequential_List.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Sequential_Search.cpp -O2 -o Sequential_Search -std=c++20
+// ./Sequential_Search
+
+/// ============================================================================================================
+/// 对比查找/计数内核：标量循环、SSE2、AVX2(CPU支持时)，以及Sequential_List::Find/Count(运行时选择内核)
+/// 1. Find查找不存在的元素，扫描整个表
+/// 2. Count统计约1/8的元素
+/// 注：-O2下编译器可能自动向量化Count_Scalar，Find_Scalar因为提前退出通常不会被向量化
+/// ============================================================================================================
+
+template <typename ElementType>
+void Suite(const std::string &type, size_t count, size_t rounds)
+{
+	Benchmark::Report_Header(type + " n=" + std::to_string(count));
+	Sequential_List_Dynamic<ElementType> list(count);
+	for (size_t i = 0; i < count; i++)
+		list.Element_Insert(i + 1, static_cast<ElementType>(i % 8 + 1));
+	std::vector<ElementType> elements(count);
+	for (size_t i = 0; i < count; i++)
+		elements[i] = list[i + 1];
+	const ElementType *data = elements.data(), absent = static_cast<ElementType>(0), present = static_cast<ElementType>(3);
+
+	size_t sum{};
+	auto run = [&](const std::string &name, auto &&kernel)
+	{
+		double nanoseconds = Benchmark::Measure([&]()
+		{
+			for (size_t round = 0; round < rounds; round++)
+				sum += kernel();
+		});
+		Benchmark::Report(name, count * rounds, nanoseconds);
+	};
+	run("Find Scalar", [&]() { return Search::Find_Scalar(data, count, absent); });
+#ifdef SEQUENTIAL_SEARCH_SIMD
+	run("Find SSE2", [&]() { return Search::Find_SSE2(data, count, absent); });
+	if (Search::Has_AVX2())
+		run("Find AVX2", [&]() { return Search::Find_AVX2(data, count, absent); });
+#endif
+	run("Sequential_List::Find", [&]() { return list.Find(absent); });
+
+	run("Count Scalar", [&]() { return Search::Count_Scalar(data, count, present); });
+#ifdef SEQUENTIAL_SEARCH_SIMD
+	run("Count SSE2", [&]() { return Search::Count_SSE2(data, count, present); });
+	if (Search::Has_AVX2())
+		run("Count AVX2", [&]() { return Search::Count_AVX2(data, count, present); });
+#endif
+	run("Sequential_List::Count", [&]() { return list.Count(present); });
+	Benchmark::Do_Not_Optimize(sum);
+}
+
+int main()
+{
+	for (size_t count : {10'000, 10'000'000})
+	{
+		size_t rounds = 100'000'000 / count;
+		Suite<signed char>("int8", count, rounds);
+		Suite<int>("int32", count, rounds);
+		Suite<long long>("int64", count, rounds);
+		Suite<float>("float", count, rounds);
+		Suite<double>("double", count, rounds);
+	}
+	return 0;
+}
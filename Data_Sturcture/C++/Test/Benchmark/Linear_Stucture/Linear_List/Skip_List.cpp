@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_List/Link_List/Skip_List.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Skip_List.cpp -O2 -o Skip_List -std=c++20
+// ./Skip_List
+
+/// ============================================================================================================
+/// 跳表的插入/删除吞吐：n个不重复的随机键依次插入，再按另一随机顺序全部删除
+/// 插入和删除都要先记录每层的前驱(搜索路径)，搜索路径的存储方式直接影响单次操作的开销
+///
+/// 搜索路径改为栈上数组前后的结果(ns/op)：
+/// 		之前：成员std::map<size_t, Node*>，每次操作clear后重新插入各层，且每一层都从头结点重新向后查找
+/// 			n=1000   insert 2300  delete 2169
+/// 			n=10000  insert 50174 delete 55778 (每层从头查找，退化为O(n))
+/// 		之后：std::array<Node*, max_level>局部变量，每层从上一层停下的节点继续
+/// 			n=1000   insert 273   delete 130
+/// 			n=10000  insert 288   delete 206
+/// 			n=100000 insert 596   delete 418
+///
+/// 节点改为单次分配+大小分级节点池前后的结果(ns/op)，bytes/element为向operator new申请的字节数：
+/// 		之前：List_Node_Skiplist，节点和next数组各new一次，每次跳层多一次指针解引用
+/// 			n=1000    insert 224  search 113  delete 128   allocations/element 2  bytes/element 40(另有malloc每块的头部和对齐)
+/// 			n=100000  insert 504  search 424  delete 429
+/// 			n=1000000 insert 1604 search 1228 delete 1578
+/// 		之后：List_Node_Skiplist_Inline，next数组紧跟在元素之后，按层数从Node_Pool_Sized分配
+/// 			n=1000    insert 148  search 78   delete 97    allocations/element 0.002(每个16KB的slab一次)  bytes/element 32.8
+/// 			n=100000  insert 289  search 275  delete 262
+/// 			n=1000000 insert 873  search 853  delete 823
+///
+/// 层数的随机数(Level)：生成count个节点层数的耗时
+/// 		rand()每层调用一次 vs Random::Level从一个xorshift64*随机数的前导零得到层数
+/// 			p=0.5   rand() 34.5  Random::Level 2.5
+/// 			p=0.25  rand() 23.1  Random::Level 2.4
+/// 			p=0.3   不是1/2^k，逐层比较阈值 7.8
+/// 		跳表插入随之由 n=1000 148->127，n=1000000 873->797
+///
+/// 节点每层增加跨度后，按排名访问的结果(ns/op)：
+/// 		n=1000    rank 90    select 94    range by rank(10) 120
+/// 		n=1000000 rank 1236  select 1340  range by rank(10) 2504(随机起点，区间内每个节点一次缓存缺失)
+/// 		代价：bytes/element 32.1 -> 48.1，insert定位时累加跨度并更新前驱的跨度
+/// 			n=1000    insert 116->164  search 77->79    delete 95->122
+/// 			n=1000000 insert 780->1228 search 911->1017 delete 921->1385
+///
+/// 从有序序列构造(Build)：n次Element_Insert vs 批量构造(随机层数/确定性层数)
+/// 			n=1000    逐个插入 123  批量随机 50  批量确定性 40
+/// 			n=1000000 逐个插入 156  批量随机 71  批量确定性 59
+/// 		批量构造的单次耗时不随n增长；有序输入时逐个插入的路径都在缓存中，增长也很慢
+/// 所有用例先调用Random::Thread_Local<>::Seed，结果可复现
+/// ============================================================================================================
+
+/// 统计堆分配：替换全局operator new/delete，记录申请次数和字节数
+size_t allocation_count{}, allocation_bytes{};
+void *operator new(size_t bytes)
+{
+	++allocation_count;
+	allocation_bytes += bytes;
+	if (void *memory = std::malloc(bytes ? bytes : 1))
+		return memory;
+	throw std::bad_alloc{};
+}
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+
+void Insert_Delete(size_t count)
+{
+	std::vector<int> keys(count);
+	for (size_t i = 0; i < count; i++)
+		keys[i] = static_cast<int>(i);
+	std::mt19937 random{42};
+	std::shuffle(keys.begin(), keys.end(), random);
+
+	Skip_List<int> list;
+	size_t count_before{allocation_count}, bytes_before{allocation_bytes};
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (int key : keys)
+			list.Element_Insert(key);
+	});
+	Benchmark::Report("insert n=" + std::to_string(count), count, nanoseconds);
+	std::cout << std::setprecision(3) << "\tallocations/element " << double(allocation_count - count_before) / count
+			  << "\tbytes/element " << double(allocation_bytes - bytes_before) / count << std::endl;
+
+	std::shuffle(keys.begin(), keys.end(), random);
+	size_t found{};
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		for (int key : keys)
+			found += list.Element_Search(key).has_value();
+	});
+	Benchmark::Do_Not_Optimize(found);
+	Benchmark::Report("search n=" + std::to_string(count), count, nanoseconds);
+
+	size_t total{};
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		for (int key : keys)
+			total += list.Rank(key);
+	});
+	Benchmark::Report("rank n=" + std::to_string(count), count, nanoseconds);
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		for (int key : keys)
+			total += list.Select(static_cast<size_t>(key) + 1);
+	});
+	Benchmark::Report("select n=" + std::to_string(count), count, nanoseconds);
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		for (int key : keys) // 每次取排名从key开始的前10个元素，与排行榜分页相同
+			for (int element : list.Range_By_Rank(static_cast<size_t>(key) + 1, static_cast<size_t>(key) + 10))
+				total += element;
+	});
+	Benchmark::Report("range by rank(10) n=" + std::to_string(count), count, nanoseconds);
+	Benchmark::Do_Not_Optimize(total);
+
+	std::shuffle(keys.begin(), keys.end(), random);
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		for (int key : keys)
+			list.Element_Delete(key);
+	});
+	Benchmark::Report("delete n=" + std::to_string(count), count, nanoseconds);
+}
+
+template <float probable>
+void Level_Rand(size_t count)
+{
+	static constexpr auto threshold = RAND_MAX * probable;
+	size_t total{};
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			size_t level{};
+			while (level < 31 && rand() <= threshold)
+				++level;
+			total += level;
+		}
+	});
+	Benchmark::Do_Not_Optimize(total);
+	Benchmark::Report("rand() p=" + std::to_string(probable).substr(0, 4), count, nanoseconds);
+}
+
+template <float probable>
+void Level_Random(size_t count)
+{
+	Random::Thread_Local<> random;
+	size_t total{};
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+			total += Random::Level<probable>(random, 31);
+	});
+	Benchmark::Do_Not_Optimize(total);
+	Benchmark::Report("Random::Level p=" + std::to_string(probable).substr(0, 4), count, nanoseconds);
+}
+
+void Build(size_t count)
+{
+	using List = Skip_List<int>;
+	std::vector<int> keys(count);
+	for (size_t i = 0; i < count; i++)
+		keys[i] = static_cast<int>(i);
+
+	size_t total{};
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		List list;
+		for (int key : keys)
+			list.Element_Insert(key);
+		total += list.Get_Size();
+	});
+	Benchmark::Report("insert one by one n=" + std::to_string(count), count, nanoseconds);
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		List list(keys.begin(), keys.end(), List::Level_Assignment::Random);
+		total += list.Get_Size();
+	});
+	Benchmark::Report("bulk random n=" + std::to_string(count), count, nanoseconds);
+	nanoseconds = Benchmark::Measure([&]()
+	{
+		List list(keys.begin(), keys.end(), List::Level_Assignment::Deterministic);
+		total += list.Get_Size();
+	});
+	Benchmark::Report("bulk deterministic n=" + std::to_string(count), count, nanoseconds);
+	Benchmark::Do_Not_Optimize(total);
+}
+
+int main()
+{
+	Random::Thread_Local<>::Seed(42);
+	srand(42);
+	Benchmark::Report_Header("Level");
+	Level_Rand<0.5f>(10'000'000);
+	Level_Random<0.5f>(10'000'000);
+	Level_Rand<0.25f>(10'000'000);
+	Level_Random<0.25f>(10'000'000);
+	Level_Random<0.3f>(10'000'000);
+
+	Benchmark::Report_Header("Build");
+	for (size_t count = 1000; count <= 1'000'000; count *= 10)
+		Build(count);
+
+	Benchmark::Report_Header("Skip_List<int>");
+	for (size_t count = 1000; count <= 1'000'000; count *= 10)
+		Insert_Delete(count);
+	return 0;
+}
@@ -0,0 +1,119 @@
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_List/Link_List/Skip_List.hpp"
+#include "../../../../Linear_Structure/Linear_List/Link_List/Skip_List_Concurrent.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Skip_List_Concurrent.cpp -O2 -o Skip_List_Concurrent -std=c++20 -pthread
+// ./Skip_List_Concurrent
+
+/// ============================================================================================================
+/// 多线程吞吐：key_range个键中预先插入一半，每个线程执行operations次随机操作
+/// 读比例为read_percent%的查找，其余插入和删除各占一半，元素个数大致保持不变
+/// 		Skip_List_Concurrent：无锁跳表
+/// 		Skip_List + shared_mutex：查找加共享锁，插入删除加独占锁
+/// ns/op为总耗时/所有线程的总操作数，线程数超过CPU核数时只反映竞争开销
+///
+/// 单核机器上的结果(ns/op，约100000个元素)：
+/// 			         读90%               读50%               读10%
+/// 		1线程  无锁 340  加锁 337    无锁 413  加锁 423    无锁 462  加锁 458
+/// 		4线程  无锁 351  加锁 333    无锁 455  加锁 449    无锁 534  加锁 537
+/// 		单核上线程不会真正并行，两者持平：无锁跳表的原子操作和回收域开销与一次加锁相当
+/// 		多核上加锁跳表的写操作互相串行，无锁跳表的吞吐随线程数增长，需要在多核机器上重新测量
+/// ============================================================================================================
+
+constexpr int key_range = 200'000;
+constexpr size_t operations = 200'000;
+
+/// 无锁跳表直接调用
+struct Lock_Free
+{
+	Skip_List_Concurrent<int> list;
+	bool Search(int key) { return list.Contains(key); }
+	bool Insert(int key) { return list.Try_Insert(key); }
+	bool Delete(int key) { return list.Try_Delete(key); }
+};
+
+/// 单线程跳表加读写锁
+struct Locked
+{
+	Skip_List<int> list;
+	std::shared_mutex mutex;
+	bool Search(int key)
+	{
+		std::shared_lock lock(mutex);
+		return list.Element_Search(key).has_value();
+	}
+	bool Insert(int key)
+	{
+		std::unique_lock lock(mutex);
+		if (list.Element_Search(key))
+			return false;
+		list.Element_Insert(key);
+		return true;
+	}
+	bool Delete(int key)
+	{
+		std::unique_lock lock(mutex);
+		if (!list.Element_Search(key))
+			return false;
+		list.Element_Delete(key);
+		return true;
+	}
+};
+
+template <typename Set>
+void Throughput(const std::string &name, size_t thread_count, unsigned read_percent)
+{
+	Set set;
+	for (int key = 0; key < key_range; key += 2)
+		set.Insert(key);
+
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		std::vector<std::thread> threads;
+		for (size_t id = 0; id < thread_count; id++)
+			threads.emplace_back([&, id]()
+			{
+				std::mt19937 random(static_cast<unsigned>(id));
+				size_t found{};
+				for (size_t i = 0; i < operations; i++)
+				{
+					int key = static_cast<int>(random() % key_range);
+					unsigned choice = random() % 100;
+					if (choice < read_percent)
+						found += set.Search(key);
+					else if (choice % 2)
+						found += set.Insert(key);
+					else
+						found += set.Delete(key);
+				}
+				Benchmark::Do_Not_Optimize(found);
+			});
+		for (auto &thread : threads)
+			thread.join();
+	});
+	Benchmark::Report(name + " threads=" + std::to_string(thread_count) + " read=" + std::to_string(read_percent) + "%",
+					  operations * thread_count, nanoseconds);
+}
+
+int main()
+{
+	Random::Thread_Local<>::Seed(42);
+	size_t max_threads = std::thread::hardware_concurrency() > 4 ? std::thread::hardware_concurrency() : 4;
+	for (unsigned read_percent : {90u, 50u, 10u})
+	{
+		Benchmark::Report_Header("read " + std::to_string(read_percent) + "%");
+		for (size_t thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+		{
+			Throughput<Lock_Free>("lock-free", thread_count, read_percent);
+			Throughput<Locked>("shared_mutex", thread_count, read_percent);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,69 @@
+#include <string>
+
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Linked/Link_Queue.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Link_Queue.cpp -O2 -o Link_Queue -std=c++20
+// ./Link_Queue
+
+/// ============================================================================================================
+/// 对比节点分配策略：Policy::Node_New 与 Policy::Node_Pool
+/// 1. 稳定状态：队列保持depth个元素，每次入队一个、出队一个，节点池中出队的节点立即被复用
+/// 2. 入队n个元素后Clear
+/// ============================================================================================================
+
+template <typename QueueType, typename ElementType>
+void Steady(const std::string &name, size_t depth, size_t count, const ElementType &element)
+{
+	QueueType queue;
+	for (size_t i = 0; i < depth; i++)
+		queue.Element_Enqueue(element);
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			queue.Element_Enqueue(element);
+			queue.Element_Dequeue();
+		}
+	});
+	Benchmark::Do_Not_Optimize(queue.Get_Front());
+	Benchmark::Report(name + " depth=" + std::to_string(depth), count * 2, nanoseconds);
+}
+
+template <typename QueueType, typename ElementType>
+void Enqueue_Clear(const std::string &name, size_t count, const ElementType &element, size_t rounds)
+{
+	QueueType queue;
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t round = 0; round < rounds; round++)
+		{
+			for (size_t i = 0; i < count; i++)
+				queue.Element_Enqueue(element);
+			queue.Clear();
+		}
+	});
+	Benchmark::Do_Not_Optimize(queue.Get_Size());
+	Benchmark::Report(name + " enqueue+Clear", count * rounds, nanoseconds);
+}
+
+template <typename ElementType>
+void Suite(const std::string &type, const ElementType &element)
+{
+	using Node = List_Node_SingleWay<ElementType>;
+	Benchmark::Report_Header("Link_Queue<" + type + ">");
+	for (size_t depth : {16, 100'000})
+	{
+		Steady<Link_Queue<ElementType>>("new/delete", depth, 1'000'000, element);
+		Steady<Link_Queue<ElementType, Node, Policy::Node_Pool<>>>("Node_Pool", depth, 1'000'000, element);
+	}
+	Enqueue_Clear<Link_Queue<ElementType>>("new/delete", 1'000'000, element, 10);
+	Enqueue_Clear<Link_Queue<ElementType, Node, Policy::Node_Pool<>>>("Node_Pool", 1'000'000, element, 10);
+}
+
+int main()
+{
+	Suite<int>("int", 42);
+	Suite<std::string>("std::string", std::string(32, 'x'));
+	return 0;
+}
@@ -0,0 +1,115 @@
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Linked/Link_Queue.hpp"
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Linked/Link_Queue_Concurrent.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Link_Queue_Concurrent.cpp -O2 -o Link_Queue_Concurrent -std=c++20 -pthread
+// ./Link_Queue_Concurrent
+
+/// ============================================================================================================
+/// 吞吐：producer_count个生产者共入队count个int，consumer_count个消费者全部出队，队空时yield重试
+/// 		Link_Queue_Concurrent + Policy::Node_Thread_Cache：回收的节点在线程缓存中复用
+/// 		Link_Queue_Concurrent + Policy::Node_New：每个节点单独new/delete
+/// 		Link_Queue + std::mutex
+/// ns/op为总耗时/元素个数，线程数超过CPU核数时只反映竞争开销
+///
+/// 单核机器上的结果(ns/op)：
+/// 			         1消费者              2消费者              4消费者
+/// 		1生产者  缓存 70  new 90  加锁 75   缓存 60  new 86  加锁 77   缓存 64  new 89  加锁 75
+/// 		4生产者  缓存 72  new 97  加锁 78   缓存 68  new 89  加锁 77   缓存 63  new 88  加锁 76
+/// 		节点由生产者分配、消费者回收：只有线程缓存时节点留在消费者的缓存中，生产者仍然每次new，
+/// 		与new/delete持平(约92)；加入全局仓库整批转移后，生产者复用消费者回收的节点
+/// 		单核上无锁队列每次操作的回收域进入/退出(含一次seq_cst栅栏)与加锁开销相当，多核需要重新测量
+/// ============================================================================================================
+
+constexpr int count = 2'000'000;
+
+/// 无锁队列直接调用
+template <typename AllocatorPolicy>
+struct Lock_Free
+{
+	Link_Queue_Concurrent<int, AllocatorPolicy> queue;
+	void Enqueue(int element) { queue.Element_Enqueue(element); }
+	bool Try_Dequeue(int &element) { return queue.Try_Dequeue(element); }
+};
+
+/// 单线程链式队列加锁
+struct Locked
+{
+	Link_Queue<int> queue;
+	std::mutex mutex;
+	void Enqueue(int element)
+	{
+		std::lock_guard lock(mutex);
+		queue.Element_Enqueue(element);
+	}
+	bool Try_Dequeue(int &element)
+	{
+		std::lock_guard lock(mutex);
+		if (queue.Is_Empty())
+			return false;
+		element = queue.Get_Front();
+		queue.Element_Dequeue();
+		return true;
+	}
+};
+
+template <typename QueueType>
+void Throughput(const std::string &name, int producer_count, int consumer_count)
+{
+	QueueType queue;
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		std::atomic<int> remaining{count};
+		std::vector<std::thread> threads;
+		for (int id = 0; id < producer_count; id++)
+			threads.emplace_back([&, id]()
+			{
+				// 元素平均分给各生产者，余数由第一个生产者入队
+				int share = count / producer_count + (id == 0 ? count % producer_count : 0);
+				for (int i = 0; i < share; i++)
+					queue.Enqueue(i);
+			});
+		for (int id = 0; id < consumer_count; id++)
+			threads.emplace_back([&]()
+			{
+				long long sum{};
+				int element{};
+				while (remaining.load(std::memory_order_relaxed) > 0)
+				{
+					if (!queue.Try_Dequeue(element))
+					{
+						std::this_thread::yield();
+						continue;
+					}
+					remaining.fetch_sub(1, std::memory_order_relaxed);
+					sum += element;
+				}
+				Benchmark::Do_Not_Optimize(sum);
+			});
+		for (auto &thread : threads)
+			thread.join();
+	});
+	Benchmark::Report(name + " producers=" + std::to_string(producer_count) + " consumers=" + std::to_string(consumer_count),
+					  static_cast<size_t>(count), nanoseconds);
+}
+
+int main()
+{
+	for (int producer_count : {1, 4})
+	{
+		Benchmark::Report_Header("producers " + std::to_string(producer_count));
+		for (int consumer_count : {1, 2, 4})
+		{
+			Throughput<Lock_Free<Policy::Node_Thread_Cache<>>>("thread cache", producer_count, consumer_count);
+			Throughput<Lock_Free<Policy::Node_New>>("new/delete", producer_count, consumer_count);
+			Throughput<Locked>("Link_Queue + mutex", producer_count, consumer_count);
+		}
+	}
+	return 0;
+}
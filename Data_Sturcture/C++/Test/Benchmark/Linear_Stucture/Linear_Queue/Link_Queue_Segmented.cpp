@@ -0,0 +1,104 @@
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Linked/Link_Queue.hpp"
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Linked/Link_Queue_Segmented.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Link_Queue_Segmented.cpp -O2 -o Link_Queue_Segmented -std=c++20
+// ./Link_Queue_Segmented
+
+/// ============================================================================================================
+/// 对比每个元素一个节点的Link_Queue(Node_New/Node_Pool)与分段队列Link_Queue_Segmented<64>
+/// 1. 稳定状态：队列保持depth个元素，每次入队一个、出队一个，同时统计测量期间的operator new次数
+/// 2. 突发：入队n个元素后全部出队，重复rounds次
+///
+/// 结果(ns/op，allocations为测量期间operator new的次数)：
+/// 		int          稳定 depth=16      new/delete 5.5   Node_Pool 1.7  Segmented 2.2   allocations 1000000 / 0 / 0
+/// 		             稳定 depth=100000  new/delete 5.2   Node_Pool 1.9  Segmented 2.3   allocations 1000000 / 0 / 0
+/// 		             突发 n=100000      new/delete 7.9   Node_Pool 2.3  Segmented 2.4
+/// 		std::string  稳定 depth=16      new/delete 12.4  Node_Pool 8.6  Segmented 7.3   (每次入队拷贝字符串都要分配一次)
+/// 		             稳定 depth=100000  new/delete 11.9  Node_Pool 8.0  Segmented 7.6
+/// 		             突发 n=100000      new/delete 19.2  Node_Pool 12.0 Segmented 11.7
+/// 		Segmented与Node_Pool都消除了每个元素一次的new/delete，int时两者相差在0.5ns以内；
+/// 		Segmented每个int元素只占4字节(Link_Queue的节点为16字节)，元素连续存放
+/// ============================================================================================================
+
+/// 统计堆分配：替换全局operator new/delete，记录申请次数
+size_t allocation_count{};
+void *operator new(size_t bytes)
+{
+	++allocation_count;
+	if (void *memory = std::malloc(bytes ? bytes : 1))
+		return memory;
+	throw std::bad_alloc{};
+}
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+
+template <typename QueueType, typename ElementType>
+void Steady(const std::string &name, size_t depth, size_t count, const ElementType &element)
+{
+	QueueType queue;
+	for (size_t i = 0; i < depth; i++)
+		queue.Element_Enqueue(element);
+	for (size_t i = 0; i < depth + 128; i++) // 预热：至少跨过一个块的边界，Node_Pool和Segmented的空闲链表中已有节点
+	{
+		queue.Element_Enqueue(element);
+		queue.Element_Dequeue();
+	}
+	size_t count_before = allocation_count;
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			queue.Element_Enqueue(element);
+			queue.Element_Dequeue();
+		}
+	});
+	size_t allocations = allocation_count - count_before;
+	Benchmark::Do_Not_Optimize(queue.Get_Front());
+	Benchmark::Report(name + " depth=" + std::to_string(depth) + " allocations=" + std::to_string(allocations), count * 2, nanoseconds);
+}
+
+template <typename QueueType, typename ElementType>
+void Burst(const std::string &name, size_t count, const ElementType &element, size_t rounds)
+{
+	QueueType queue;
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t round = 0; round < rounds; round++)
+		{
+			for (size_t i = 0; i < count; i++)
+				queue.Element_Enqueue(element);
+			for (size_t i = 0; i < count; i++)
+				queue.Element_Dequeue();
+		}
+	});
+	Benchmark::Do_Not_Optimize(queue.Get_Size());
+	Benchmark::Report(name + " burst n=" + std::to_string(count), count * rounds * 2, nanoseconds);
+}
+
+template <typename ElementType>
+void Suite(const std::string &type, const ElementType &element)
+{
+	using Node = List_Node_SingleWay<ElementType>;
+	Benchmark::Report_Header("Queue<" + type + ">");
+	for (size_t depth : {16, 100'000})
+	{
+		Steady<Link_Queue<ElementType>>("new/delete", depth, 1'000'000, element);
+		Steady<Link_Queue<ElementType, Node, Policy::Node_Pool<>>>("Node_Pool", depth, 1'000'000, element);
+		Steady<Link_Queue_Segmented<ElementType>>("Segmented", depth, 1'000'000, element);
+	}
+	Burst<Link_Queue<ElementType>>("new/delete", 100'000, element, 10);
+	Burst<Link_Queue<ElementType, Node, Policy::Node_Pool<>>>("Node_Pool", 100'000, element, 10);
+	Burst<Link_Queue_Segmented<ElementType>>("Segmented", 100'000, element, 10);
+}
+
+int main()
+{
+	Suite<int>("int", 42);
+	Suite<std::string>("std::string", std::string(32, 'x'));
+	return 0;
+}
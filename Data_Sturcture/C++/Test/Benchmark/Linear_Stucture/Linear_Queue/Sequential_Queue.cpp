@@ -0,0 +1,83 @@
+#include <string>
+#include <utility> //as_const
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Sequential/Sequential_Queue.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Sequential_Queue.cpp -O2 -o Sequential_Queue -std=c++20
+// ./Sequential_Queue
+
+/// ============================================================================================================
+/// 突发传输：每轮入队burst个元素再全部出队，队列容量1024，每轮的起始位置不同，部分批次跨过数组末尾
+/// 		逐个：Element_Enqueue / Get_Front + Element_Dequeue，每个元素计算一次取模和判断满/空
+/// 		批量：Enqueue_Bulk / Dequeue_Bulk，最多两段连续拷贝
+///
+/// 结果(ns/element)：
+/// 		Redundancy<int>          burst=16  逐个 2.8  批量 0.56    burst=256  逐个 5.2  批量 0.11
+/// 		Tag<int>                 burst=16  逐个 1.7  批量 0.56    burst=256  逐个 2.1  批量 0.11
+/// 		Redundancy<string(32)>   burst=256 逐个 21.0 批量 21.5    Tag<string(32)> 逐个 19.9 批量 22.1
+/// 		平凡类型的两段拷贝是memmove；非平凡类型仍需逐个拷贝构造和析构，元素本身的开销占主要部分，没有收益
+/// ============================================================================================================
+
+constexpr size_t capcity = 1024;
+
+template <typename QueueType, typename ElementType>
+void Single(const std::string &name, size_t burst, size_t rounds, const ElementType &element)
+{
+	QueueType queue;
+	std::vector<ElementType> output(burst);
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t round = 0; round < rounds; round++)
+		{
+			for (size_t i = 0; i < burst; i++)
+				queue.Element_Enqueue(element);
+			for (size_t i = 0; i < burst; i++)
+			{
+				output[i] = std::move(queue.Get_Front());
+				queue.Element_Dequeue();
+			}
+			Benchmark::Do_Not_Optimize(output.front());
+		}
+	});
+	Benchmark::Report(name + " single burst=" + std::to_string(burst), burst * rounds, nanoseconds);
+}
+
+template <typename QueueType, typename ElementType>
+void Bulk(const std::string &name, size_t burst, size_t rounds, const ElementType &element)
+{
+	QueueType queue;
+	std::vector<ElementType> input(burst, element), output(burst);
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t round = 0; round < rounds; round++)
+		{
+			queue.Enqueue_Bulk(std::as_const(input));
+			queue.Dequeue_Bulk(output);
+			Benchmark::Do_Not_Optimize(output.front());
+		}
+	});
+	Benchmark::Report(name + " bulk burst=" + std::to_string(burst), burst * rounds, nanoseconds);
+}
+
+template <typename ElementType>
+void Suite(const std::string &type, const ElementType &element, std::initializer_list<size_t> bursts)
+{
+	Benchmark::Report_Header("Sequential_Queue<" + type + ", 1024>");
+	for (size_t burst : bursts)
+	{
+		size_t rounds = 10'000'000 / burst;
+		Single<Sequential_Queue_Redundancy<ElementType, capcity>>("Redundancy", burst, rounds, element);
+		Bulk<Sequential_Queue_Redundancy<ElementType, capcity>>("Redundancy", burst, rounds, element);
+		Single<Sequential_Queue_Tag<ElementType, capcity>>("Tag", burst, rounds, element);
+		Bulk<Sequential_Queue_Tag<ElementType, capcity>>("Tag", burst, rounds, element);
+	}
+}
+
+int main()
+{
+	Suite<int>("int", 42, {16, 256});
+	Suite<std::string>("std::string", std::string(32, 'x'), {256});
+	return 0;
+}
@@ -0,0 +1,104 @@
+#include <string>
+
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Linked/Link_Queue.hpp"
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Linked/Link_Queue_Segmented.hpp"
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Sequential/Sequential_Queue_Growable.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Sequential_Queue_Growable.cpp -O2 -o Sequential_Queue_Growable -std=c++20
+// ./Sequential_Queue_Growable
+
+/// ============================================================================================================
+/// 长度不受限制的队列：Link_Queue(new/delete) / Link_Queue_Segmented<64> / Sequential_Queue_Growable
+/// 1. 稳定状态：队列保持depth个元素，每次入队一个、出队一个
+/// 2. 突发：从空队列开始入队n个元素再全部出队(Growable从初始容量16开始逐次翻倍)
+/// 3. 遍历：队列中有n个元素时依次出队求和，比较内存布局对顺序访问的影响
+///
+/// 结果(ns/op)：
+/// 		int          稳定 depth=16      Link 7.5   Segmented 2.2  Growable 1.1
+/// 		             稳定 depth=100000  Link 6.7   Segmented 2.2  Growable 1.1
+/// 		             突发 n=1000000     Link 17.1  Segmented 4.8  Growable 2.0(含16次扩容)
+/// 		             遍历 n=1000000     Link 8.8   Segmented 2.7  Growable 2.6
+/// 		std::string  稳定 depth=16      Link 15.9  Segmented 9.5  Growable 9.2
+/// 		             突发 n=1000000     Link 41.7  Segmented 25.8 Growable 26.1
+/// 		std::string(32)每次拷贝都要分配一次，元素本身的开销占主要部分，Growable与Segmented相差在5%以内
+/// ============================================================================================================
+
+template <typename QueueType, typename ElementType>
+void Steady(const std::string &name, size_t depth, size_t count, const ElementType &element)
+{
+	QueueType queue;
+	for (size_t i = 0; i < depth + 128; i++)
+		queue.Element_Enqueue(element);
+	for (size_t i = 0; i < 128; i++)
+		queue.Element_Dequeue();
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			queue.Element_Enqueue(element);
+			queue.Element_Dequeue();
+		}
+	});
+	Benchmark::Do_Not_Optimize(queue.Get_Front());
+	Benchmark::Report(name + " steady depth=" + std::to_string(depth), count * 2, nanoseconds);
+}
+
+template <typename QueueType, typename ElementType>
+void Burst(const std::string &name, size_t count, const ElementType &element)
+{
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		QueueType queue;
+		for (size_t i = 0; i < count; i++)
+			queue.Element_Enqueue(element);
+		for (size_t i = 0; i < count; i++)
+			queue.Element_Dequeue();
+		Benchmark::Do_Not_Optimize(queue.Get_Size());
+	});
+	Benchmark::Report(name + " burst n=" + std::to_string(count), count * 2, nanoseconds);
+}
+
+template <typename QueueType>
+void Drain(const std::string &name, size_t count)
+{
+	QueueType queue;
+	for (size_t i = 0; i < count; i++)
+		queue.Element_Enqueue(static_cast<int>(i));
+	long long sum{};
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		while (!queue.Is_Empty())
+		{
+			sum += queue.Get_Front();
+			queue.Element_Dequeue();
+		}
+	});
+	Benchmark::Do_Not_Optimize(sum);
+	Benchmark::Report(name + " drain n=" + std::to_string(count), count, nanoseconds);
+}
+
+template <typename ElementType>
+void Suite(const std::string &type, const ElementType &element)
+{
+	Benchmark::Report_Header("Queue<" + type + ">");
+	for (size_t depth : {16, 100'000})
+	{
+		Steady<Link_Queue<ElementType>>("Link_Queue", depth, 1'000'000, element);
+		Steady<Link_Queue_Segmented<ElementType>>("Segmented", depth, 1'000'000, element);
+		Steady<Sequential_Queue_Growable<ElementType>>("Growable", depth, 1'000'000, element);
+	}
+	Burst<Link_Queue<ElementType>>("Link_Queue", 1'000'000, element);
+	Burst<Link_Queue_Segmented<ElementType>>("Segmented", 1'000'000, element);
+	Burst<Sequential_Queue_Growable<ElementType>>("Growable", 1'000'000, element);
+}
+
+int main()
+{
+	Suite<int>("int", 42);
+	Drain<Link_Queue<int>>("Link_Queue", 1'000'000);
+	Drain<Link_Queue_Segmented<int>>("Segmented", 1'000'000);
+	Drain<Sequential_Queue_Growable<int>>("Growable", 1'000'000);
+	Suite<std::string>("std::string", std::string(32, 'x'));
+	return 0;
+}
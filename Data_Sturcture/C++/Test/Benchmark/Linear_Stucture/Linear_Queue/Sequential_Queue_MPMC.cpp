@@ -0,0 +1,108 @@
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Sequential/Sequential_Queue.hpp"
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Sequential/Sequential_Queue_MPMC.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Sequential_Queue_MPMC.cpp -O2 -o Sequential_Queue_MPMC -std=c++20 -pthread
+// ./Sequential_Queue_MPMC
+
+/// ============================================================================================================
+/// 吞吐：producer_count个生产者共入队count个int，consumer_count个消费者全部出队，队满/队空时yield重试
+/// 		Sequential_Queue_MPMC 对比 Sequential_Queue_Tag + std::mutex
+/// ns/op为总耗时/元素个数，线程数超过CPU核数时只反映竞争开销
+///
+/// 单核机器上的结果(ns/op)：
+/// 			      1消费者             2消费者             4消费者
+/// 		1生产者  MPMC 34.1  加锁 46.7   MPMC 34.2  加锁 47.0   MPMC 35.0  加锁 47.8
+/// 		2生产者  MPMC 34.6  加锁 47.1   MPMC 35.6  加锁 49.2   MPMC 35.9  加锁 49.3
+/// 		4生产者  MPMC 35.4  加锁 48.0   MPMC 36.6  加锁 48.6   MPMC 37.0  加锁 49.7
+/// 		两者都包含消费者对remaining的fetch_sub；单核上线程轮流运行，差距主要是两次加锁解锁与两次CAS的差别
+/// 		多核上加锁队列的所有操作互相串行，MPMC队列只有同一位置的操作竞争，需要在多核机器上重新测量
+/// ============================================================================================================
+
+constexpr size_t capcity = 1024;
+constexpr int count = 2'000'000;
+
+/// 加锁的单线程队列，接口与Sequential_Queue_MPMC的Try_版本相同
+struct Locked_Queue
+{
+	Sequential_Queue_Tag<int, capcity> queue;
+	std::mutex mutex;
+	bool Try_Enqueue(int element)
+	{
+		std::lock_guard lock(mutex);
+		if (queue.Is_Full())
+			return false;
+		queue.Element_Enqueue(element);
+		return true;
+	}
+	bool Try_Dequeue(int &element)
+	{
+		std::lock_guard lock(mutex);
+		if (queue.Is_Empty())
+			return false;
+		element = queue.Get_Front();
+		queue.Element_Dequeue();
+		return true;
+	}
+};
+
+template <typename QueueType>
+void Throughput(const std::string &name, int producer_count, int consumer_count)
+{
+	QueueType queue;
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		std::atomic<int> remaining{count};
+		std::vector<std::thread> threads;
+		for (int id = 0; id < producer_count; id++)
+			threads.emplace_back([&, id]()
+			{
+				// 元素平均分给各生产者，余数由第一个生产者入队
+				int share = count / producer_count + (id == 0 ? count % producer_count : 0);
+				for (int i = 0; i < share; i++)
+					while (!queue.Try_Enqueue(i))
+						std::this_thread::yield();
+			});
+		for (int id = 0; id < consumer_count; id++)
+			threads.emplace_back([&]()
+			{
+				long long sum{};
+				int element{};
+				while (remaining.load(std::memory_order_relaxed) > 0)
+				{
+					if (!queue.Try_Dequeue(element))
+					{
+						std::this_thread::yield();
+						continue;
+					}
+					remaining.fetch_sub(1, std::memory_order_relaxed);
+					sum += element;
+				}
+				Benchmark::Do_Not_Optimize(sum);
+			});
+		for (auto &thread : threads)
+			thread.join();
+	});
+	Benchmark::Report(name + " producers=" + std::to_string(producer_count) + " consumers=" + std::to_string(consumer_count),
+					  static_cast<size_t>(count), nanoseconds);
+}
+
+int main()
+{
+	for (int producer_count : {1, 2, 4})
+	{
+		Benchmark::Report_Header("producers " + std::to_string(producer_count));
+		for (int consumer_count : {1, 2, 4})
+		{
+			Throughput<Sequential_Queue_MPMC<int, capcity>>("MPMC", producer_count, consumer_count);
+			Throughput<Locked_Queue>("Tag + mutex", producer_count, consumer_count);
+		}
+	}
+	return 0;
+}
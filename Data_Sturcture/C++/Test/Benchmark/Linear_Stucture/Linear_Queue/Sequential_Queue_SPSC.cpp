@@ -0,0 +1,138 @@
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Sequential/Sequential_Queue.hpp"
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Sequential/Sequential_Queue_SPSC.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Sequential_Queue_SPSC.cpp -O2 -o Sequential_Queue_SPSC -std=c++20 -pthread
+// ./Sequential_Queue_SPSC
+
+/// ============================================================================================================
+/// 1. 单线程：队列保持半满，每次入队一个、出队一个。对比 % (maxsize+1) 与 & mask 的下标计算
+/// 2. 吞吐：生产者线程入队count个int，消费者线程全部出队，队满/队空时yield重试
+/// 		Sequential_Queue_SPSC 对比 Sequential_Queue_Tag + std::mutex
+/// 3. 延迟：两个队列往返(ping-pong)，一条消息从发出到收到回复的平均时间
+/// 		单核机器上线程不会同时运行，每次往返都包含线程切换，只能比较相对开销
+///
+/// 单核机器上的结果(ns/op)：
+/// 		单线程  Redundancy 1.8  Tag 1.4  SPSC 0.9
+/// 		吞吐    mutex 37.6  SPSC 4.5
+/// 		往返    mutex 1250  SPSC 1100    往返时间主要是两次线程切换
+/// ============================================================================================================
+
+constexpr size_t capcity = 1024;
+
+template <typename QueueType>
+void Single_Thread(const std::string &name, size_t count)
+{
+	QueueType queue;
+	for (size_t i = 0; i < capcity / 2; i++)
+		queue.Element_Enqueue(static_cast<int>(i));
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			queue.Element_Enqueue(static_cast<int>(i));
+			queue.Element_Dequeue();
+		}
+	});
+	Benchmark::Do_Not_Optimize(queue.Get_Front());
+	Benchmark::Report(name + " single thread", count * 2, nanoseconds);
+}
+
+/// 加锁的单线程队列，接口与Sequential_Queue_SPSC的Try_版本相同
+struct Locked_Queue
+{
+	Sequential_Queue_Tag<int, capcity> queue;
+	std::mutex mutex;
+	bool Try_Enqueue(int element)
+	{
+		std::lock_guard lock(mutex);
+		if (queue.Is_Full())
+			return false;
+		queue.Element_Enqueue(element);
+		return true;
+	}
+	bool Try_Dequeue(int &element)
+	{
+		std::lock_guard lock(mutex);
+		if (queue.Is_Empty())
+			return false;
+		element = queue.Get_Front();
+		queue.Element_Dequeue();
+		return true;
+	}
+};
+
+template <typename QueueType>
+void Throughput(const std::string &name, int count)
+{
+	QueueType queue;
+	long long sum{};
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		std::thread producer([&]()
+		{
+			for (int i = 0; i < count; i++)
+				while (!queue.Try_Enqueue(i))
+					std::this_thread::yield();
+		});
+		int element{};
+		for (int i = 0; i < count; i++)
+		{
+			while (!queue.Try_Dequeue(element))
+				std::this_thread::yield();
+			sum += element;
+		}
+		producer.join();
+	});
+	Benchmark::Do_Not_Optimize(sum);
+	Benchmark::Report(name + " throughput", static_cast<size_t>(count), nanoseconds);
+}
+
+template <typename QueueType>
+void Round_Trip(const std::string &name, int count)
+{
+	QueueType ping, pong;
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		std::thread echo([&]()
+		{
+			int element{};
+			for (int i = 0; i < count; i++)
+			{
+				while (!ping.Try_Dequeue(element))
+					std::this_thread::yield();
+				while (!pong.Try_Enqueue(element))
+					std::this_thread::yield();
+			}
+		});
+		int element{};
+		for (int i = 0; i < count; i++)
+		{
+			while (!ping.Try_Enqueue(i))
+				std::this_thread::yield();
+			while (!pong.Try_Dequeue(element))
+				std::this_thread::yield();
+		}
+		echo.join();
+	});
+	Benchmark::Report(name + " round trip", static_cast<size_t>(count), nanoseconds);
+}
+
+int main()
+{
+	Benchmark::Report_Header("Sequential_Queue<int, 1024>");
+	Single_Thread<Sequential_Queue_Redundancy<int, capcity>>("Redundancy", 10'000'000);
+	Single_Thread<Sequential_Queue_Tag<int, capcity>>("Tag", 10'000'000);
+	Single_Thread<Sequential_Queue_SPSC<int, capcity>>("SPSC", 10'000'000);
+
+	Throughput<Locked_Queue>("Tag + mutex", 10'000'000);
+	Throughput<Sequential_Queue_SPSC<int, capcity>>("SPSC", 10'000'000);
+
+	Round_Trip<Locked_Queue>("Tag + mutex", 100'000);
+	Round_Trip<Sequential_Queue_SPSC<int, capcity>>("SPSC", 100'000);
+	return 0;
+}
@@ -0,0 +1,66 @@
+#include <string>
+
+#include "../../../../Linear_Structure/Linear_Stack/Linear_Stack_Linked/Link_Stack.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Link_Stack.cpp -O2 -o Link_Stack -std=c++20
+// ./Link_Stack
+
+/// ============================================================================================================
+/// 对比节点分配策略：Policy::Node_New 与 Policy::Node_Pool
+/// 1. 入栈n个元素，再逐个出栈
+/// 2. 入栈n个元素后Clear
+/// ============================================================================================================
+
+template <typename StackType, typename ElementType>
+void Push_Pop(const std::string &name, size_t count, const ElementType &element, size_t rounds)
+{
+	StackType stack;
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t round = 0; round < rounds; round++)
+		{
+			for (size_t i = 0; i < count; i++)
+				stack.Element_Push(element);
+			for (size_t i = 0; i < count; i++)
+				stack.Element_Pop();
+		}
+	});
+	Benchmark::Do_Not_Optimize(stack.Get_Size());
+	Benchmark::Report(name + " push+pop", count * rounds * 2, nanoseconds);
+}
+
+template <typename StackType, typename ElementType>
+void Push_Clear(const std::string &name, size_t count, const ElementType &element, size_t rounds)
+{
+	StackType stack;
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		for (size_t round = 0; round < rounds; round++)
+		{
+			for (size_t i = 0; i < count; i++)
+				stack.Element_Push(element);
+			stack.Clear();
+		}
+	});
+	Benchmark::Do_Not_Optimize(stack.Get_Size());
+	Benchmark::Report(name + " push+Clear", count * rounds, nanoseconds);
+}
+
+template <typename ElementType>
+void Suite(const std::string &type, const ElementType &element)
+{
+	using Node = List_Node_SingleWay<ElementType>;
+	Benchmark::Report_Header("Link_Stack<" + type + ">");
+	Push_Pop<Link_Stack<ElementType>>("new/delete", 1'000'000, element, 10);
+	Push_Pop<Link_Stack<ElementType, Node, Policy::Node_Pool<>>>("Node_Pool", 1'000'000, element, 10);
+	Push_Clear<Link_Stack<ElementType>>("new/delete", 1'000'000, element, 10);
+	Push_Clear<Link_Stack<ElementType, Node, Policy::Node_Pool<>>>("Node_Pool", 1'000'000, element, 10);
+}
+
+int main()
+{
+	Suite<int>("int", 42);
+	Suite<std::string>("std::string", std::string(32, 'x'));
+	return 0;
+}
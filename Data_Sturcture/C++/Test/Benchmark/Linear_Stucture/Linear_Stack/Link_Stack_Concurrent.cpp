@@ -0,0 +1,106 @@
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_Stack/Linear_Stack_Linked/Link_Stack.hpp"
+#include "../../../../Linear_Structure/Linear_Stack/Linear_Stack_Linked/Link_Stack_Concurrent.hpp"
+#include "../../Benchmark.hpp"
+
+// g++ Link_Stack_Concurrent.cpp -O2 -o Link_Stack_Concurrent -std=c++20 -pthread
+// ./Link_Stack_Concurrent
+
+/// ============================================================================================================
+/// 吞吐：thread_count个线程共执行count次"入栈一个int再出栈一个"，栈中预先放入64个元素，出栈总能成功
+/// 		Link_Stack_Concurrent + Policy::Node_Thread_Cache：回收的节点在线程缓存中复用
+/// 		Link_Stack_Concurrent + Policy::Node_New：每个节点单独new/delete
+/// 		Link_Stack + std::mutex / Link_Stack<Node_Pool> + std::mutex
+/// ns/op为总耗时/(入栈+出栈次数)，线程数超过CPU核数时只反映竞争开销
+///
+/// 单核机器上的结果(ns/op)：
+/// 		                1线程   2线程   4线程   8线程
+/// 		缓存            24.6    32.1    37.3    35.6
+/// 		new/delete      42.7    47.0    50.6    53.1
+/// 		加锁            30.3    30.2    31.9    30.9
+/// 		加锁+Node_Pool  26.2    27.0    28.1    27.9
+/// 		单线程时无锁栈比加锁的Link_Stack快约20%；多线程时节点在线程之间转移，回收域中的节点要等所有线程
+/// 		经过纪元才能复用，线程缓存的命中率下降，单核上反而比加锁慢约20%(此时互斥锁几乎没有争用)。
+/// 		new/delete的无锁栈始终最慢，节点复用是主要收益。多核上CAS与锁的竞争需要重新测量
+/// ============================================================================================================
+
+constexpr int count = 2'000'000;
+constexpr int depth = 64;
+
+/// 无锁栈直接调用
+template <typename AllocatorPolicy>
+struct Lock_Free
+{
+	Link_Stack_Concurrent<int, AllocatorPolicy> stack;
+	void Push(int element) { stack.Element_Push(element); }
+	bool Try_Pop(int &element) { return stack.Try_Pop(element); }
+};
+
+/// 单线程链栈加锁
+template <typename AllocatorPolicy>
+struct Locked
+{
+	Link_Stack<int, List_Node_SingleWay<int>, AllocatorPolicy> stack;
+	std::mutex mutex;
+	void Push(int element)
+	{
+		std::lock_guard lock(mutex);
+		stack.Element_Push(element);
+	}
+	bool Try_Pop(int &element)
+	{
+		std::lock_guard lock(mutex);
+		if (stack.Is_Empty())
+			return false;
+		element = stack.Get_Top();
+		stack.Element_Pop();
+		return true;
+	}
+};
+
+template <typename StackType>
+void Throughput(const std::string &name, int thread_count)
+{
+	StackType stack;
+	for (int i = 0; i < depth; i++)
+		stack.Push(i);
+	double nanoseconds = Benchmark::Measure([&]()
+	{
+		std::vector<std::thread> threads;
+		for (int id = 0; id < thread_count; id++)
+			threads.emplace_back([&, id]()
+			{
+				// 操作平均分给各线程，余数由第一个线程执行
+				int share = count / thread_count + (id == 0 ? count % thread_count : 0);
+				long long sum{};
+				int element{};
+				for (int i = 0; i < share; i++)
+				{
+					stack.Push(i);
+					if (stack.Try_Pop(element))
+						sum += element;
+				}
+				Benchmark::Do_Not_Optimize(sum);
+			});
+		for (auto &thread : threads)
+			thread.join();
+	});
+	Benchmark::Report(name + " threads=" + std::to_string(thread_count), static_cast<size_t>(count) * 2, nanoseconds);
+}
+
+int main()
+{
+	for (int thread_count : {1, 2, 4, 8})
+	{
+		Benchmark::Report_Header("threads " + std::to_string(thread_count));
+		Throughput<Lock_Free<Policy::Node_Thread_Cache<>>>("thread cache", thread_count);
+		Throughput<Lock_Free<Policy::Node_New>>("new/delete", thread_count);
+		Throughput<Locked<Policy::Node_New>>("Link_Stack + mutex", thread_count);
+		Throughput<Locked<Policy::Node_Pool<>>>("Link_Stack<Node_Pool> + mutex", thread_count);
+	}
+	return 0;
+}
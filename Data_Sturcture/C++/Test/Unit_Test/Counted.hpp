@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <compare>
+#include <iostream>
+#include <stdexcept>
+
+/// 记录存活对象个数的元素，用于检查容器只构造了有效位置的元素，并且每个元素恰好析构一次
+/// - 没有默认构造函数：容器如果默认构造了空闲位置，测试无法编译
+/// - alive是原子变量，并发容器的测试也可以在多个线程中构造和析构
+/// - 每个测试结束时应回到0，测试之间不需要清零
+struct Counted
+{
+    static inline std::atomic<int> alive{};
+    int value;
+
+    explicit Counted(int value) : value{value} { ++alive; }
+    Counted(const Counted &other) : value{other.value} { ++alive; }
+    Counted(Counted &&other) noexcept : value{other.value} { ++alive; }
+    Counted &operator=(const Counted &) = default;
+    Counted &operator=(Counted &&) noexcept = default;
+    ~Counted() { --alive; }
+
+    auto operator<=>(const Counted &) const = default;
+    friend std::ostream &operator<<(std::ostream &os, const Counted &element) { return os << element.value; }
+};
+
+/// 哨兵节点、出队目标等需要默认构造的场合使用，默认值为-1
+struct Counted_Default : Counted
+{
+    Counted_Default() : Counted{-1} {}
+    explicit Counted_Default(int value) : Counted{value} {}
+};
+
+/// 拷贝值为负数的元素时抛出异常，用于检查容器在拷贝失败时不泄漏、不改变状态；移动不抛出
+struct Throw_On_Copy : Counted
+{
+    explicit Throw_On_Copy(int value) : Counted{value} {}
+    Throw_On_Copy(const Throw_On_Copy &other) : Counted{_Checked(other.value)} {}
+    Throw_On_Copy(Throw_On_Copy &&) noexcept = default;
+    Throw_On_Copy &operator=(const Throw_On_Copy &) = default;
+    Throw_On_Copy &operator=(Throw_On_Copy &&) noexcept = default;
+
+private:
+    static int _Checked(int value)
+    {
+        if (value < 0)
+            throw std::runtime_error("copy");
+        return value;
+    }
+};
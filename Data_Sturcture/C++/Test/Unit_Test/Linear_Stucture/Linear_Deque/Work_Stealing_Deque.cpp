@@ -0,0 +1,152 @@
+#define BOOST_TEST_MODULE Work_Stealing_Deque
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_Deque/Work_Stealing_Deque.hpp"
+
+// g++ Work_Stealing_Deque.cpp -g -o Work_Stealing_Deque -lboost_unit_test_framework -std=c++20 -pthread
+// valgrind --leak-check=full ./Work_Stealing_Deque
+// 检查数据竞争：加上 -fsanitize=thread
+
+BOOST_AUTO_TEST_CASE(Operations)
+{
+    Work_Stealing_Deque<int> deque(2);
+    int element{};
+    BOOST_CHECK(deque.Is_Empty() && deque.Get_Size() == 0 && deque.Get_Capcity() == 2);
+    BOOST_CHECK(!deque.Try_Pop(element) && !deque.Try_Steal(element));
+
+    for (int i = 1; i <= 100; i++) // 从容量2开始扩容
+        deque.Element_Push(i);
+    BOOST_CHECK(deque.Get_Size() == 100 && deque.Get_Capcity() == 128);
+    for (int i = 100; i > 90; i--) // 拥有者后进先出
+        BOOST_REQUIRE(deque.Try_Pop(element) && element == i);
+    for (int i = 1; i <= 10; i++) // 窃取者先进先出
+        BOOST_REQUIRE(deque.Try_Steal(element) && element == i);
+    BOOST_CHECK(deque.Get_Size() == 80);
+
+    for (int round = 0; round < 200; round++) // 长度保持80，下标不断增加，环形数组位置绕回，不再扩容
+    {
+        deque.Element_Push(1000 + round);
+        BOOST_REQUIRE(deque.Try_Steal(element) && element == (round < 80 ? 11 + round : 1000 + round - 80));
+    }
+    BOOST_CHECK(deque.Get_Size() == 80 && deque.Get_Capcity() == 128);
+    BOOST_CHECK(deque.Try_Pop(element) && element == 1199);
+
+    deque.Clear();
+    BOOST_CHECK(deque.Is_Empty() && !deque.Try_Pop(element) && !deque.Try_Steal(element));
+    deque.Element_Push(7);
+    BOOST_CHECK(deque.Try_Steal(element) && element == 7 && deque.Is_Empty());
+}
+
+/// 拥有者入队并不时出队，多个窃取者同时窃取，初始容量为2，扩容与窃取并发：
+/// 每个元素恰好被取出一次；元素从顶部到底部递增，同一个窃取者取到的元素递增
+BOOST_AUTO_TEST_CASE(Owner_Thieves)
+{
+    constexpr int thief_count = 3, count = 200000;
+    Work_Stealing_Deque<int> deque(2);
+    std::vector<std::atomic<int>> received(count);
+    std::atomic<int> taken{};
+    std::atomic<bool> ordered{true};
+
+    std::vector<std::thread> thieves;
+    for (int id = 0; id < thief_count; id++)
+        thieves.emplace_back([&]()
+        {
+            int last{-1}, element{};
+            while (taken.load() < count)
+            {
+                if (!deque.Try_Steal(element))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                received[element].fetch_add(1);
+                taken.fetch_add(1);
+                if (element <= last)
+                    ordered.store(false);
+                last = element;
+            }
+        });
+
+    int element{};
+    for (int i = 0; i < count; i++)
+    {
+        deque.Element_Push(i);
+        if (i % 4 == 3)
+            for (int j = 0; j < 2 && deque.Try_Pop(element); j++)
+            {
+                received[element].fetch_add(1);
+                taken.fetch_add(1);
+            }
+    }
+    while (deque.Try_Pop(element))
+    {
+        received[element].fetch_add(1);
+        taken.fetch_add(1);
+    }
+    for (auto &thief : thieves)
+        thief.join();
+
+    bool exactly_once{true};
+    for (auto &times : received)
+        exactly_once &= times.load() == 1;
+    BOOST_CHECK(exactly_once && ordered.load() && deque.Is_Empty());
+}
+
+/// 递归拆分的并行求和：每个工作线程拆分自己的区间，一半入队、一半继续拆分，自己的双端队列为空时窃取其他线程的区间
+struct Range
+{
+    uint32_t first, last; // [first,last)
+};
+BOOST_AUTO_TEST_CASE(Parallel_Sum)
+{
+    constexpr int worker_count = 4;
+    constexpr uint32_t count = 1 << 20, grain = 64;
+    std::vector<std::unique_ptr<Work_Stealing_Deque<Range>>> deques;
+    for (int id = 0; id < worker_count; id++)
+        deques.push_back(std::make_unique<Work_Stealing_Deque<Range>>(4));
+    deques[0]->Element_Push({0, count});
+
+    std::atomic<uint64_t> sum{};
+    std::atomic<uint32_t> done{}; // 已经求和的元素个数
+    std::vector<std::thread> workers;
+    for (int id = 0; id < worker_count; id++)
+        workers.emplace_back([&, id]()
+        {
+            Range range;
+            while (done.load() < count)
+            {
+                bool found = deques[id]->Try_Pop(range);
+                for (int victim = (id + 1) % worker_count; !found && victim != id; victim = (victim + 1) % worker_count)
+                    found = deques[victim]->Try_Steal(range);
+                if (!found)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                while (range.last - range.first > grain)
+                {
+                    uint32_t middle = range.first + (range.last - range.first) / 2;
+                    deques[id]->Element_Push({middle, range.last});
+                    range.last = middle;
+                }
+                uint64_t partial{};
+                for (uint32_t value = range.first; value < range.last; value++)
+                    partial += value;
+                sum.fetch_add(partial);
+                done.fetch_add(range.last - range.first);
+            }
+        });
+    for (auto &worker : workers)
+        worker.join();
+
+    BOOST_CHECK(sum.load() == uint64_t{count} * (count - 1) / 2 && done.load() == count);
+    for (auto &deque : deques)
+        BOOST_CHECK(deque->Is_Empty());
+}
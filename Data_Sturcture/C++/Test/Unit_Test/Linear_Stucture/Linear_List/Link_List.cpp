@@ -219,3 +219,326 @@ BOOST_AUTO_TEST_CASE(Operations_Dynamic_Element)
         BOOST_CHECK(list.Get_Size() == 3);
     }
 }
+
+#include <string>
+template <typename ListType>
+void _Node_Allocator()
+{
+    ListType list;
+    for (size_t i = 1; i <= 200; i++) // 超过一个slab
+        list.Element_Insert(i, std::to_string(i));
+    for (size_t i = 1; i <= 100; i++) // 删除的节点进入空闲链表
+        list.Element_Delete(1);
+    for (size_t i = 1; i <= 100; i++) // 复用空闲节点
+        list.Element_Insert(1, std::to_string(i));
+    BOOST_CHECK(list.Get_Size() == 200);
+    BOOST_CHECK(list[1] == "100" && list[100] == "1" && list[101] == "101" && list[200] == "200");
+
+    ListType list_copy(list);
+    BOOST_CHECK(list_copy.Get_Size() == 200 && list_copy[200] == "200");
+    ListType list_move(std::move(list));
+    BOOST_CHECK(list.Is_Empty() && list_move[101] == "101");
+    list_copy = list_move;
+    BOOST_CHECK(list_copy.Get_Size() == 200 && list_copy[1] == "100");
+
+    list_move.List_Clear(); // 整体释放
+    BOOST_CHECK(list_move.Is_Empty());
+    list_move.Element_Insert(1, "reuse");
+    BOOST_CHECK(list_move[1] == "reuse");
+    list_copy = std::move(list_move);
+    BOOST_CHECK(list_copy.Get_Size() == 1 && list_copy[1] == "reuse");
+}
+BOOST_AUTO_TEST_CASE(Node_Allocator)
+{
+    _Node_Allocator<Link_List_Forward<std::string>>();
+    _Node_Allocator<Link_List_Double<std::string>>();
+    _Node_Allocator<Link_List_Forward<std::string, Policy::Node_Pool<>>>();
+    _Node_Allocator<Link_List_Double<std::string, Policy::Node_Pool<16>>>();
+}
+
+#include <random>
+/// 游标缓存：与std::vector对照，随机插入/删除后顺序、逆序和随机位置访问的结果一致
+template <typename ListType>
+void _Cursor_Access()
+{
+    ListType list;
+    std::vector<int> expect;
+    std::mt19937 random{42};
+    for (int i = 0; i < 2000; i++)
+    {
+        size_t pos = random() % (expect.size() + 1) + 1;
+        if (!expect.empty() && random() % 3 == 0)
+        {
+            pos = random() % expect.size() + 1;
+            list.Element_Delete(pos);
+            expect.erase(expect.begin() + (pos - 1));
+        }
+        else
+        {
+            list.Element_Insert(pos, i);
+            expect.insert(expect.begin() + (pos - 1), i);
+        }
+        size_t probe = random() % (expect.size() + 1); // 移动游标
+        if (probe)
+            BOOST_REQUIRE(list[probe] == expect[probe - 1]);
+    }
+    BOOST_REQUIRE(list.Get_Size() == expect.size());
+    for (size_t pos = 1; pos <= expect.size(); pos++)
+        BOOST_REQUIRE(list[pos] == expect[pos - 1]);
+    for (size_t pos = expect.size(); pos >= 1; pos--)
+        BOOST_REQUIRE(list[pos] == expect[pos - 1]);
+
+    list.List_Clear();
+    list.Element_Insert(1, 7);
+    BOOST_CHECK(list[1] == 7);
+}
+BOOST_AUTO_TEST_CASE(Cursor_Access)
+{
+    _Cursor_Access<Link_List_Forward<int>>();
+    _Cursor_Access<Link_List_Double<int>>();
+    _Cursor_Access<Link_List_Static<int, 2048>>(); // 静态链表没有游标，作为随机插入/删除的对照
+}
+
+#include <algorithm>
+#include <ranges>
+static_assert(std::forward_iterator<Link_List_Forward<int>::iterator>);
+static_assert(std::forward_iterator<Link_List_Forward<int>::const_iterator>);
+static_assert(std::bidirectional_iterator<Link_List_Double<int>::iterator>);
+static_assert(std::bidirectional_iterator<Link_List_Static<int, 5>::const_iterator>);
+static_assert(std::ranges::forward_range<Link_List_Forward<int>>);
+static_assert(std::ranges::bidirectional_range<const Link_List_Double<int>>);
+
+template <typename ListType>
+void _Iterators(ListType &list)
+{
+    for (int i = 1; i <= 6; i++)
+        list.Element_Insert(i, i);
+
+    std::vector<int> elements(list.begin(), list.end());
+    BOOST_CHECK((elements == std::vector<int>{1, 2, 3, 4, 5, 6}));
+    for (auto &element : list) // 通过可变迭代器修改
+        element *= 10;
+    const ListType &list_const = list;
+    BOOST_CHECK(*list_const.begin() == 10);
+    BOOST_CHECK(std::ranges::find(list_const, 30) != list_const.end());
+    BOOST_CHECK(std::ranges::count_if(list, [](int element) { return element > 30; }) == 3);
+
+    auto even = list | std::views::filter([](int element) { return element % 20 == 0; })
+                     | std::views::transform([](int element) { return element / 10; });
+    BOOST_CHECK((std::vector<int>(even.begin(), even.end()) == std::vector<int>{2, 4, 6}));
+    typename ListType::const_iterator position = list.begin(); // iterator转换为const_iterator
+
+    auto inserted = list.insert_after(position, 15); // 10 15 20 ...
+    BOOST_CHECK(*inserted == 15 && list.Get_Size() == 7 && list[2] == 15);
+    auto after = list.erase(inserted);
+    BOOST_CHECK(*after == 20 && list.Get_Size() == 6 && list[2] == 20);
+    after = list.erase(list.begin()); // 删除首元素
+    BOOST_CHECK(*after == 20 && list[1] == 20);
+    after = list.erase_after(after); // 删除30
+    BOOST_CHECK(*after == 40 && list.Get_Size() == 4);
+
+    auto last = list.begin();
+    std::ranges::advance(last, list.Get_Size() - 1);
+    list.insert_after(last, 70); // 尾插后继续尾插
+    list.Element_Insert(list.Get_Size() + 1, 80);
+    elements.assign(list.begin(), list.end());
+    BOOST_CHECK((elements == std::vector<int>{20, 40, 50, 60, 70, 80}));
+    BOOST_CHECK_THROW(list.insert_after(list.end(), 0), std::out_of_range);
+    BOOST_CHECK_THROW(list.erase(list.end()), std::out_of_range);
+
+    if constexpr (std::bidirectional_iterator<typename ListType::iterator>)
+    {
+        auto reverse = list | std::views::reverse;
+        BOOST_CHECK((std::vector<int>(reverse.begin(), reverse.end()) == std::vector<int>{80, 70, 60, 50, 40, 20}));
+        BOOST_CHECK(*std::prev(list.end()) == 80);
+    }
+    while (!list.Is_Empty())
+        list.erase(list.begin());
+    BOOST_CHECK(list.begin() == list.end());
+    list.Element_Insert(1, 1);
+    BOOST_CHECK(*list.begin() == 1);
+}
+BOOST_AUTO_TEST_CASE(Iterators)
+{
+    Link_List_Forward<int> list_forward;
+    _Iterators(list_forward);
+    Link_List_Double<int, Policy::Node_Pool<>> list_double;
+    _Iterators(list_double);
+    Link_List_Static<int, 8> list_static;
+    _Iterators(list_static);
+}
+
+/// 静态链表的空闲列表：填满后随机删除再插入，归还的位置被复用，满时抛出异常
+BOOST_AUTO_TEST_CASE(Static_Free_List)
+{
+    constexpr size_t maxsize = 64;
+    Link_List_Static<int, maxsize> list;
+    std::vector<int> expect;
+    for (size_t i = 1; i <= maxsize; i++)
+    {
+        list.Element_Insert(i, static_cast<int>(i));
+        expect.push_back(static_cast<int>(i));
+    }
+    BOOST_CHECK_THROW(list.Element_Insert(1, 0), std::runtime_error);
+
+    std::mt19937 random{7};
+    for (int round = 0; round < 1000; round++)
+    {
+        size_t pos = random() % expect.size() + 1;
+        list.Element_Delete(pos);
+        expect.erase(expect.begin() + (pos - 1));
+        if (random() % 2)
+        {
+            pos = random() % expect.size() + 1;
+            list.Element_Delete(pos);
+            expect.erase(expect.begin() + (pos - 1));
+        }
+        while (expect.size() < maxsize)
+        {
+            pos = random() % (expect.size() + 1) + 1;
+            list.Element_Insert(pos, round);
+            expect.insert(expect.begin() + (pos - 1), round);
+        }
+        BOOST_REQUIRE_THROW(list.Element_Insert(1, 0), std::runtime_error);
+    }
+    BOOST_CHECK(std::ranges::equal(list, expect));
+
+    Link_List_Static<int, maxsize> list_copy{list}; // 拷贝后空闲列表各自独立
+    list.Element_Delete(1);
+    list_copy.Element_Delete(maxsize);
+    list.Element_Insert(1, -1);
+    list_copy.Element_Insert(maxsize, -2);
+    BOOST_CHECK(list[1] == -1 && list[2] == expect[1]);
+    BOOST_CHECK(list_copy[maxsize] == -2 && list_copy[1] == expect[0]);
+    list.List_Clear();
+    for (size_t i = 1; i <= maxsize; i++)
+        list.Element_Insert(1, static_cast<int>(i));
+    BOOST_CHECK(list.Get_Size() == maxsize && list[1] == static_cast<int>(maxsize));
+}
+
+/// 排序、拼接与归并只修改链接：与std::vector对照，并检查尾节点和双向链接
+template <typename ListType>
+void _Check_Equal(ListType &list, const std::vector<int> &expect)
+{
+    BOOST_REQUIRE(list.Get_Size() == expect.size());
+    BOOST_REQUIRE(std::ranges::equal(list, expect));
+    if (!expect.empty())
+        BOOST_REQUIRE(list[expect.size()] == expect.back());
+    if constexpr (std::bidirectional_iterator<typename ListType::iterator>)
+        BOOST_REQUIRE(std::ranges::equal(list | std::views::reverse, expect | std::views::reverse));
+    list.Element_Insert(list.Get_Size() + 1, -1); // 尾插依赖rear
+    list.Element_Delete(list.Get_Size());
+}
+template <typename ListType>
+void _Sort_Splice_Merge()
+{
+    std::mt19937 random{11};
+    auto by_tens = [](int x, int y) { return x / 10 < y / 10; }; // 只比较十位以上，检查稳定性
+    for (size_t count : {0, 1, 2, 3, 7, 64, 1000})
+    {
+        ListType list;
+        std::vector<int> expect;
+        for (size_t i = 0; i < count; i++)
+        {
+            int element = static_cast<int>(random() % 500);
+            list.Element_Insert(i + 1, element);
+            expect.push_back(element);
+        }
+        int *address = count ? &list[1] : nullptr;
+        list.Sort(by_tens);
+        std::ranges::stable_sort(expect, by_tens);
+        _Check_Equal(list, expect);
+        BOOST_CHECK(!address || std::ranges::find_if(list, [address](int &element) { return &element == address; }) != list.end()); // 节点没有重新分配
+        list.Sort(std::greater<>{});
+        std::ranges::sort(expect, std::greater<>{});
+        _Check_Equal(list, expect);
+    }
+
+    ListType list{1, 2, 3}, other{4, 5, 6, 7};
+    list.Splice(list.Get_Size() + 1, other); // 尾部拼接
+    _Check_Equal(list, {1, 2, 3, 4, 5, 6, 7});
+    BOOST_CHECK(other.Is_Empty() && other.begin() == other.end());
+    other.Splice(1, list, 3, 5); // 中间一段移动到空表
+    _Check_Equal(list, {1, 2, 6, 7});
+    _Check_Equal(other, {3, 4, 5});
+    list.Splice(1, other, 3, 3); // 表尾的一个元素移动到表头
+    _Check_Equal(list, {5, 1, 2, 6, 7});
+    _Check_Equal(other, {3, 4});
+    list.Splice(4, other); // 整表插入中间
+    _Check_Equal(list, {5, 1, 2, 3, 4, 6, 7});
+    BOOST_CHECK(other.Is_Empty());
+    other.Splice(1, list, 1, 7);
+    BOOST_CHECK(list.Is_Empty() && list.begin() == list.end());
+    _Check_Equal(other, {5, 1, 2, 3, 4, 6, 7});
+    BOOST_CHECK_THROW(list.Splice(1, other, 0, 1), std::out_of_range);
+    BOOST_CHECK_THROW(list.Splice(1, other, 3, 8), std::out_of_range);
+    BOOST_CHECK_THROW(list.Splice(2, other), std::out_of_range);
+    BOOST_CHECK_THROW(list.Splice(1, list), std::logic_error);
+
+    list = ListType{1, 3, 3, 8};
+    other = ListType{0, 3, 4, 9, 10};
+    list.Merge(other);
+    _Check_Equal(list, {0, 1, 3, 3, 3, 4, 8, 9, 10});
+    BOOST_CHECK(other.Is_Empty());
+    other.Merge(list, std::less<>{}); // 归并到空表
+    _Check_Equal(other, {0, 1, 3, 3, 3, 4, 8, 9, 10});
+    other.Merge(list);
+    BOOST_CHECK(other.Get_Size() == 9);
+}
+BOOST_AUTO_TEST_CASE(Sort_Splice_Merge)
+{
+    _Sort_Splice_Merge<Link_List_Forward<int>>();
+    _Sort_Splice_Merge<Link_List_Double<int>>();
+    Link_List_Double<int, Policy::Node_Pool<>> list{3, 1, 2}; // 节点池的节点不能转移，但可以排序
+    list.Sort();
+    BOOST_CHECK(list[1] == 1 && list[3] == 3);
+}
+template <typename ListType>
+concept Spliceable = requires(ListType list) { list.Splice(1, list); };
+static_assert(Spliceable<Link_List_Forward<int>> && !Spliceable<Link_List_Double<int, Policy::Node_Pool<>>>);
+
+/// 迭代器拼接直接使用迭代器所指的节点：元素的地址不变，游标失效后按位序访问仍然正确
+template <typename ListType>
+void _Splice_After()
+{
+    ListType list{1, 2, 3}, other{4, 5, 6, 7};
+    int *address = &other[2];
+    list.Splice_After(list.begin(), other, other.begin(), std::next(other.begin(), 3)); // (4,7)即5,6移动到1之后
+    _Check_Equal(list, {1, 5, 6, 2, 3});
+    _Check_Equal(other, {4, 7});
+    BOOST_CHECK(&list[2] == address);
+    list.Splice_After(std::next(list.begin(), 4), other, other.begin(), other.end()); // 表尾追加
+    _Check_Equal(list, {1, 5, 6, 2, 3, 7});
+    _Check_Equal(other, {4});
+    list.Splice_After(list.begin(), other, other.begin(), other.end()); // 空区间
+    BOOST_CHECK(list.Get_Size() == 6 && other.Get_Size() == 1);
+    BOOST_CHECK_THROW(list.Splice_After(list.end(), other, other.begin(), other.end()), std::out_of_range);
+    BOOST_CHECK_THROW(list.Splice_After(list.begin(), other, list.begin(), list.end()), std::invalid_argument);
+}
+BOOST_AUTO_TEST_CASE(Splice_Iterator)
+{
+    _Splice_After<Link_List_Forward<int>>();
+    _Splice_After<Link_List_Double<int>>();
+
+    Link_List_Double<int> list{1, 2, 3}, other{4, 5, 6, 7};
+    int *address = &other[2];
+    list.Splice(std::next(list.begin()), other, std::next(other.begin()), std::prev(other.end())); // [5,6]移动到2之前
+    _Check_Equal(list, {1, 5, 6, 2, 3});
+    _Check_Equal(other, {4, 7});
+    BOOST_CHECK(&list[2] == address);
+    list.Splice(list.begin(), other, std::next(other.begin()), other.end()); // 表尾的一个元素移动到表头
+    _Check_Equal(list, {7, 1, 5, 6, 2, 3});
+    _Check_Equal(other, {4});
+    list.Splice(list.end(), other, other.begin(), other.begin()); // 空区间
+    list.Splice(list.end(), other); // 整表追加到表尾
+    _Check_Equal(list, {7, 1, 5, 6, 2, 3, 4});
+    BOOST_CHECK(other.Is_Empty() && other.begin() == other.end());
+    other.Splice(other.end(), list, list.begin(), list.end()); // 移动到空表
+    _Check_Equal(other, {7, 1, 5, 6, 2, 3, 4});
+    BOOST_CHECK(list.Is_Empty() && list.begin() == list.end());
+    BOOST_CHECK_THROW(list.Splice(other.begin(), other), std::invalid_argument);
+    BOOST_CHECK_THROW(other.Splice(other.begin(), other), std::logic_error);
+}
+template <typename ListType>
+concept Iterator_Spliceable = requires(ListType list) { list.Splice(list.begin(), list, list.begin(), list.end()); };
+static_assert(Iterator_Spliceable<Link_List_Double<int>> && !Iterator_Spliceable<Link_List_Forward<int>>);
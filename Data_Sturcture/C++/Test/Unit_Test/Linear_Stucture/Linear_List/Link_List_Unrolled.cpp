@@ -0,0 +1,150 @@
+#define BOOST_TEST_MODULE Link_List_Unrolled
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <random>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_List/Link_List/Link_List_Unrolled.hpp"
+#include "../../../../Test/Unit_Test/Counted.hpp"
+
+// g++ Link_List_Unrolled.cpp -g -o Link_List_Unrolled -lboost_unit_test_framework -std=c++20
+// valgrind --leak-check=full ./Link_List_Unrolled
+
+static_assert(std::bidirectional_iterator<Link_List_Unrolled<int>::iterator>);
+static_assert(std::bidirectional_iterator<Link_List_Unrolled<int>::const_iterator>);
+static_assert(std::ranges::bidirectional_range<const Link_List_Unrolled<int>>);
+
+BOOST_AUTO_TEST_CASE(Con_Destruct_Copy)
+{
+    Link_List_Unrolled<int, 4> list;
+    BOOST_CHECK(list.Is_Empty() && list.Get_Size() == 0 && list.Get_Capcity() == 0);
+
+    Link_List_Unrolled<int, 4> list_initial{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    BOOST_CHECK(list_initial.Get_Size() == 9);
+    BOOST_CHECK(list_initial.Get_Node_Count() == 3); // 尾插填满节点后新建节点
+    BOOST_CHECK(list_initial.Get_Capcity() == 12);
+    for (size_t pos = 1; pos <= 9; pos++)
+        BOOST_CHECK(list_initial[pos] == static_cast<int>(pos));
+
+    Link_List_Unrolled<int, 4> list_copy{list_initial};
+    BOOST_CHECK(list_copy.Get_Size() == 9 && list_copy[9] == 9);
+    list_copy[1] = 100;
+    BOOST_CHECK(list_initial[1] == 1);
+
+    Link_List_Unrolled<int, 4> list_move{std::move(list_copy)};
+    BOOST_CHECK(list_copy.Is_Empty() && list_move[1] == 100 && list_move.Get_Size() == 9);
+    list_copy = list_move;
+    BOOST_CHECK(list_copy.Get_Size() == 9 && list_copy[5] == 5);
+    list = std::move(list_move);
+    BOOST_CHECK(list_move.Is_Empty() && list.Get_Size() == 9);
+    list_move.Element_Insert(1, 7); // 移动后仍可使用
+    BOOST_CHECK(list_move[1] == 7);
+
+    BOOST_CHECK_THROW(list[0], std::out_of_range);
+    BOOST_CHECK_THROW(list[10], std::out_of_range);
+    BOOST_CHECK_THROW(list.Element_Insert(11, 0), std::out_of_range);
+    BOOST_CHECK_THROW(list.Element_Delete(10), std::out_of_range);
+
+    list.List_Clear();
+    BOOST_CHECK(list.Is_Empty() && list.Get_Node_Count() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(Split_Merge)
+{
+    Link_List_Unrolled<int, 4> list{1, 2, 3, 4}; // [1 2 3 4]
+    list.Element_Insert(2, 10);                  // 分裂: [1 10 2] [3 4]
+    BOOST_CHECK(list.Get_Node_Count() == 2);
+    BOOST_CHECK((std::vector<int>(list.begin(), list.end()) == std::vector<int>{1, 10, 2, 3, 4}));
+
+    list.Element_Delete(1); // [10 2] [3 4]
+    list.Element_Delete(1); // [2] 少于一半，与后继合并: [2 3 4]
+    BOOST_CHECK(list.Get_Node_Count() == 1);
+    BOOST_CHECK((std::vector<int>(list.begin(), list.end()) == std::vector<int>{2, 3, 4}));
+
+    for (int i = 5; i <= 9; i++) // [2 3 4 5] [6 7 8 9]
+        list.Element_Insert(list.Get_Size() + 1, i);
+    list.Element_Insert(5, 0); // [2 3 4 5] [0 6 7] [8 9]
+    list.Element_Delete(1);    // [3 4 5] [0 6 7] [8 9]
+    list.Element_Delete(1);    // [4 5] [0 6 7] [8 9]
+    list.Element_Insert(3, 1); // [4 5] [1 0 6 7] [8 9]
+    list.Element_Delete(1);    // [5] 合并放不下，借一个元素: [5 1] [0 6 7] [8 9]
+    BOOST_CHECK(list.Get_Node_Count() == 3);
+    BOOST_CHECK(list[2] == 1 && list[3] == 0);
+    list.Element_Delete(1); // [1] 与后继合并: [1 0 6 7] [8 9]
+    BOOST_CHECK(list.Get_Node_Count() == 2);
+    BOOST_CHECK((std::vector<int>(list.begin(), list.end()) == std::vector<int>{1, 0, 6, 7, 8, 9}));
+    for (size_t pos = list.Get_Size(); pos >= 1; pos--)
+        list.Element_Delete(pos);
+    BOOST_CHECK(list.Is_Empty() && list.Get_Node_Count() == 0);
+}
+
+/// 与std::vector对照，随机插入/删除后顺序、逆序和随机位置访问的结果一致，分裂/合并/借元素时没有遗漏析构
+template <size_t capacity>
+void _Random_Operations()
+{
+    Link_List_Unrolled<Counted, capacity> list;
+    std::vector<int> expect;
+    std::mt19937 random{42};
+    for (int i = 0; i < 3000; i++)
+    {
+        if (!expect.empty() && random() % 5 < 2)
+        {
+            size_t pos = random() % expect.size() + 1;
+            list.Element_Delete(pos);
+            expect.erase(expect.begin() + (pos - 1));
+        }
+        else
+        {
+            size_t pos = random() % (expect.size() + 1) + 1;
+            list.Element_Insert(pos, Counted{i});
+            expect.insert(expect.begin() + (pos - 1), i);
+        }
+        size_t probe = random() % (expect.size() + 1);
+        if (probe)
+            BOOST_REQUIRE(list[probe].value == expect[probe - 1]);
+        BOOST_REQUIRE(Counted::alive == static_cast<int>(expect.size()));
+    }
+    BOOST_REQUIRE(list.Get_Size() == expect.size());
+    BOOST_REQUIRE(list.Get_Capcity() <= (expect.size() / (capacity / 2) + 1) * capacity); // 空间利用率不低于50%
+    for (size_t pos = 1; pos <= expect.size(); pos++)
+        BOOST_REQUIRE(list[pos].value == expect[pos - 1]);
+    for (size_t pos = expect.size(); pos >= 1; pos--)
+        BOOST_REQUIRE(list[pos].value == expect[pos - 1]);
+    BOOST_REQUIRE(std::ranges::equal(list | std::views::reverse, expect | std::views::reverse, {}, &Counted::value));
+
+    list.Element_Insert(1, list[list.Get_Size()]); // 插入表中元素的引用
+    BOOST_CHECK(list[1].value == expect.back());
+    list.Element_Update(1, Counted{-1});
+    BOOST_CHECK(list[1].value == -1);
+    list.List_Clear();
+    BOOST_CHECK(Counted::alive == 0);
+}
+BOOST_AUTO_TEST_CASE(Random_Operations)
+{
+    _Random_Operations<2>();
+    _Random_Operations<3>();
+    _Random_Operations<16>();
+}
+
+BOOST_AUTO_TEST_CASE(Iterators_Allocator)
+{
+    Link_List_Unrolled<std::string, 8, Policy::Node_Pool<4>> list;
+    for (int i = 1; i <= 20; i++)
+        list.Element_Insert(1, std::to_string(i));
+    BOOST_CHECK(*list.begin() == "20" && *std::prev(list.end()) == "1");
+    const auto &list_const = list;
+    BOOST_CHECK(std::ranges::count_if(list_const, [](const std::string &element) { return element.size() == 2; }) == 11);
+    for (auto &element : list)
+        element += "!";
+    BOOST_CHECK(list[20] == "1!");
+
+    auto list_copy = list;
+    list.List_Clear();
+    BOOST_CHECK(list_copy.Get_Size() == 20 && list_copy[1] == "20!");
+    list = std::move(list_copy);
+    BOOST_CHECK(list.Get_Size() == 20 && list[10] == "11!");
+}
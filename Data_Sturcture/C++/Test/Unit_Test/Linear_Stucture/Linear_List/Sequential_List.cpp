@@ -10,6 +10,7 @@
 #include "../../../../Linear_Structure/Linear_List/Sequential_List/Sequential_List.hpp"
 
 #include "../../../../Test/Unit_Test/Test_Element.hpp"
+#include "../../../../Test/Unit_Test/Counted.hpp"
 
 // g++ Sequential_List.cpp -g -o Sequential_List -lboost_unit_test_framework -std=c++20
 // valgrind --leak-check=full ./Sequential_List
@@ -241,3 +242,251 @@ BOOST_AUTO_TEST_CASE(Copy_Control_and_initializer_list)
         //     BOOST_CHECK(array_move_construct[++i] == int{});
     }
 }
+
+BOOST_AUTO_TEST_CASE(Growth_Policy_Dynamic)
+{
+    { // Reserve后插入不再扩展空间
+        Sequential_List_Dynamic<int> array_dynamic(1);
+        array_dynamic.Reserve(100);
+        BOOST_CHECK(array_dynamic.Get_Capcity() == 100);
+        for (int i = 1; i <= 100; i++)
+            array_dynamic.Element_Insert(i, i);
+        BOOST_CHECK(array_dynamic.Get_Capcity() == 100);
+        array_dynamic.Reserve(10); // 比当前容量小时不处理
+        BOOST_CHECK(array_dynamic.Get_Capcity() == 100);
+        for (int i = 1; i <= 100; i++)
+            BOOST_CHECK(array_dynamic[i] == i);
+    }
+    { // Shrink_To_Fit
+        Sequential_List_Dynamic<Element<size_t>> array_dynamic(16);
+        for (size_t i = 1; i <= 10; i++)
+            array_dynamic.Element_Insert(i, {i, 10 + i});
+        array_dynamic.Shrink_To_Fit();
+        BOOST_CHECK(array_dynamic.Get_Capcity() == 10);
+        BOOST_CHECK(array_dynamic.Get_Size() == 10);
+        for (size_t i = 1; i <= 10; i++)
+            BOOST_CHECK(array_dynamic[i] == Element<size_t>(i, 10 + i));
+        array_dynamic.List_Clear();
+        array_dynamic.Shrink_To_Fit();
+        BOOST_CHECK(array_dynamic.Get_Capcity() == 1);
+    }
+    { // 1.5倍扩展，不自动收缩
+        Sequential_List_Dynamic<int, Policy::Growth_Geometric<1.5f, 0.0f>> array_dynamic(2);
+        for (int i = 1; i <= 5; i++)
+            array_dynamic.Element_Insert(i, i);
+        BOOST_CHECK(array_dynamic.Get_Capcity() == 6); // 2->3->4->6
+        for (int i = 5; i >= 1; i--)
+            array_dynamic.Element_Delete(i);
+        BOOST_CHECK(array_dynamic.Get_Capcity() == 6);
+    }
+}
+
+#include <vector>
+#include <string>
+BOOST_AUTO_TEST_CASE(Range_Insert_Delete)
+{
+    { // Sequential_List_Static
+        Sequential_List_Static<int, 10> array_static{1, 2, 3};
+        array_static.Element_Insert(2, {7, 8, 9});
+        Check_Element(array_static, {1, 7, 8, 9, 2, 3});
+        std::vector<int> vector{4, 5};
+        array_static.Element_Insert(array_static.Get_Size() + 1, std::span<const int>(vector));
+        Check_Element(array_static, {1, 7, 8, 9, 2, 3, 4, 5});
+        array_static.Element_Insert(1, vector.begin(), vector.end());
+        Check_Element(array_static, {4, 5, 1, 7, 8, 9, 2, 3, 4, 5});
+        BOOST_CHECK_THROW(array_static.Element_Insert(1, {0}), std::runtime_error);
+        BOOST_CHECK_THROW(array_static.Element_Insert(20, {0}), std::out_of_range);
+
+        array_static.Element_Delete(4, 3);
+        Check_Element(array_static, {4, 5, 1, 2, 3, 4, 5});
+        array_static.Element_Delete(6, 2);
+        Check_Element(array_static, {4, 5, 1, 2, 3});
+        BOOST_CHECK_THROW(array_static.Element_Delete(5, 2), std::out_of_range);
+        BOOST_CHECK_THROW(array_static.Element_Delete(0, 1), std::out_of_range);
+        array_static.Element_Delete(1, 5);
+        BOOST_CHECK(array_static.Is_Empty() && array_static.Get_Capcity() == 10);
+    }
+    { // Sequential_List_Dynamic，需要扩展空间
+        Sequential_List_Dynamic<std::string> array_dynamic(2);
+        array_dynamic.Element_Insert(1, {"a", "e"});
+        array_dynamic.Element_Insert(2, {"b", "c", "d"});
+        BOOST_CHECK(array_dynamic.Get_Size() == 5);
+        BOOST_CHECK(array_dynamic.Get_Capcity() == 5);
+        std::string expect[]{"a", "b", "c", "d", "e"};
+        for (size_t i = 1; i <= 5; i++)
+            BOOST_CHECK(array_dynamic[i] == expect[i - 1]);
+
+        array_dynamic.Element_Delete(2, 3);
+        BOOST_CHECK(array_dynamic.Get_Size() == 2);
+        BOOST_CHECK(array_dynamic.Get_Capcity() == 2); // 元素个数<=1/2容量，收缩
+        BOOST_CHECK(array_dynamic[1] == "a");
+        BOOST_CHECK(array_dynamic[2] == "e");
+    }
+    { // 非平凡复制的元素
+        Sequential_List_Dynamic<Element<size_t>> array_dynamic(1);
+        std::vector<Element<size_t>> vector;
+        for (size_t i = 1; i <= 3; i++)
+            vector.emplace_back(i, 10 + i);
+        array_dynamic.Element_Insert(1, std::span<const Element<size_t>>(vector));
+        array_dynamic.Element_Insert(2, std::span<const Element<size_t>>(vector));
+        BOOST_CHECK(array_dynamic.Get_Size() == 6);
+        size_t expect[]{1, 1, 2, 3, 2, 3};
+        for (size_t i = 1; i <= 6; i++)
+            BOOST_CHECK(array_dynamic[i] == Element<size_t>(expect[i - 1], 10 + expect[i - 1]));
+        array_dynamic.Element_Delete(1, 4);
+        BOOST_CHECK(array_dynamic[1] == Element<size_t>(2, 12));
+        BOOST_CHECK(array_dynamic[2] == Element<size_t>(3, 13));
+    }
+}
+
+struct No_Default
+{
+    int value;
+    explicit No_Default(int value) : value{value} {}
+    friend std::ostream &operator<<(std::ostream &os, const No_Default &element) { return os << element.value; }
+};
+BOOST_AUTO_TEST_CASE(Non_Default_Constructible)
+{
+    Sequential_List_Static<No_Default, 5> array_static;
+    Sequential_List_Dynamic<No_Default> array_dynamic(1);
+    for (int i = 1; i <= 5; i++)
+    {
+        array_static.Element_Insert(1, No_Default{i});
+        array_dynamic.Element_Insert(1, No_Default{i});
+    }
+    BOOST_CHECK(array_static[1].value == 5 && array_dynamic[1].value == 5);
+    BOOST_CHECK(array_static[5].value == 1 && array_dynamic[5].value == 1);
+    array_static.Element_Delete(1);
+    array_dynamic.Element_Delete(1);
+    BOOST_CHECK(array_static[1].value == 4 && array_dynamic[1].value == 4);
+    array_static.List_Clear();
+    array_dynamic.List_Clear();
+    BOOST_CHECK(array_static.Is_Empty() && array_dynamic.Is_Empty());
+}
+
+/// 拷贝时元素的拷贝构造抛出异常：已申请的空间被释放(ASan检查)，已拷贝的元素被析构，赋值的目标保持不变
+BOOST_AUTO_TEST_CASE(Copy_Exception_Safety_Dynamic)
+{
+    {
+        Sequential_List_Dynamic<Throw_On_Copy> array(4);
+        array.Element_Insert(1, Throw_On_Copy{1});
+        array.Element_Insert(2, Throw_On_Copy{2});
+        array.Element_Insert(3, Throw_On_Copy{-1});
+        BOOST_CHECK_THROW(Sequential_List_Dynamic<Throw_On_Copy>{array}, std::runtime_error);
+        BOOST_CHECK(Throw_On_Copy::alive == 3);
+
+        Sequential_List_Dynamic<Throw_On_Copy> array_assign(2);
+        array_assign.Element_Insert(1, Throw_On_Copy{7});
+        BOOST_CHECK_THROW(array_assign = array, std::runtime_error);
+        BOOST_CHECK(Throw_On_Copy::alive == 4 && array_assign.Get_Size() == 1 && array_assign[1].value == 7);
+
+        BOOST_CHECK_THROW((Sequential_List_Dynamic<Throw_On_Copy>{Throw_On_Copy{3}, Throw_On_Copy{-3}}), std::runtime_error);
+        BOOST_CHECK(Throw_On_Copy::alive == 4);
+    }
+    BOOST_CHECK(Throw_On_Copy::alive == 0);
+
+    Sequential_List_Dynamic<int> array_empty(std::initializer_list<int>{}); // 空的初始化列表也保持capcity>0
+    BOOST_CHECK(array_empty.Is_Empty() && array_empty.Get_Capcity() == 1);
+    array_empty.Element_Insert(1, 7);
+    BOOST_CHECK(array_empty[1] == 7);
+}
+
+/// 小缓冲区：不超过inline_capcity个元素时不申请堆空间，超出后按增长策略扩展，收缩时搬回内部缓冲区
+BOOST_AUTO_TEST_CASE(Small_Buffer)
+{
+    using List = Sequential_List_Small<std::string, 4, Policy::Growth_Geometric<2.0f, 0.25f>>;
+    List list{"1", "2", "3"};
+    BOOST_CHECK(list.Is_Inline() && list.Get_Capcity() == 4 && list.Get_Size() == 3);
+    list.Element_Insert(4, "4");
+    BOOST_CHECK(list.Is_Inline());
+    list.Element_Insert(1, list[4]); // 溢出到堆空间，插入的元素引用表内元素
+    BOOST_CHECK(!list.Is_Inline() && list.Get_Capcity() == 8);
+    BOOST_CHECK(list[1] == "4" && list[2] == "1" && list[5] == "4");
+
+    List list_copy{list}; // 超出缓冲区时只申请刚好够用的空间
+    BOOST_CHECK(!list_copy.Is_Inline() && list_copy.Get_Capcity() == 5 && list_copy[5] == "4");
+    const std::string *address = &list[1];
+    List list_move{std::move(list)}; // 堆空间直接转移
+    BOOST_CHECK(&list_move[1] == address && list.Is_Empty() && list.Is_Inline());
+    list.Element_Insert(1, "reuse");
+    BOOST_CHECK(list[1] == "reuse");
+
+    list_move.Element_Delete(1, 3); // 剩2个元素 <= 8*0.25，收缩到4，搬回内部缓冲区
+    BOOST_CHECK(list_move.Is_Inline() && list_move.Get_Capcity() == 4);
+    BOOST_CHECK(list_move[1] == "3" && list_move[2] == "4");
+    list = std::move(list_move); // 内部缓冲区的元素逐个移动
+    BOOST_CHECK(list.Is_Inline() && list.Get_Size() == 2 && list[2] == "4" && list_move.Is_Empty());
+    list = list_copy;
+    BOOST_CHECK(!list.Is_Inline() && list.Get_Size() == 5);
+    list.Element_Delete(1, 2);
+    list.Shrink_To_Fit();
+    BOOST_CHECK(list.Is_Inline() && list.Get_Size() == 3 && list[1] == "2");
+    list.Reserve(100);
+    BOOST_CHECK(!list.Is_Inline() && list.Get_Capcity() == 100 && list[3] == "4");
+    list.List_Clear();
+    BOOST_CHECK(list.Is_Empty() && list.Get_Capcity() == 100);
+
+    Sequential_List_Small<No_Default, 2> no_default; // 元素类型不需要默认构造
+    for (int i = 1; i <= 5; i++)
+        no_default.Element_Insert(1, No_Default{i});
+    BOOST_CHECK(no_default[1].value == 5 && no_default[5].value == 1);
+}
+
+#include <random>
+/// 查找与计数：SIMD内核与标量循环的结果一致，覆盖不足一个向量的尾部和各种元素宽度
+template <typename ElementType>
+void _Find_Count()
+{
+    std::mt19937 random{3};
+    for (size_t size : {0, 1, 3, 15, 16, 17, 31, 33, 64, 127, 1000})
+    {
+        std::vector<ElementType> elements(size);
+        for (auto &element : elements)
+            element = static_cast<ElementType>(random() % 7);
+        for (int value = -1; value < 8; value++)
+        {
+            ElementType element = static_cast<ElementType>(value);
+            size_t find = Search::Find_Scalar(elements.data(), size, element), count = Search::Count_Scalar(elements.data(), size, element);
+            BOOST_REQUIRE(Search::Find(elements.data(), size, element) == find);
+            BOOST_REQUIRE(Search::Count(elements.data(), size, element) == count);
+#ifdef SEQUENTIAL_SEARCH_SIMD
+            if constexpr (Search::Vectorizable<ElementType>)
+            {
+                BOOST_REQUIRE(Search::Find_SSE2(elements.data(), size, element) == find);
+                BOOST_REQUIRE(Search::Count_SSE2(elements.data(), size, element) == count);
+                if (Search::Has_AVX2())
+                {
+                    BOOST_REQUIRE(Search::Find_AVX2(elements.data(), size, element) == find);
+                    BOOST_REQUIRE(Search::Count_AVX2(elements.data(), size, element) == count);
+                }
+            }
+#endif
+        }
+    }
+}
+BOOST_AUTO_TEST_CASE(Find_Count)
+{
+    _Find_Count<signed char>();
+    _Find_Count<unsigned short>();
+    _Find_Count<int>();
+    _Find_Count<long long>();
+    _Find_Count<float>();
+    _Find_Count<double>();
+
+    Sequential_List_Dynamic<long long> list;
+    for (long long i = 1; i <= 100; i++)
+        list.Element_Insert(list.Get_Size() + 1, i % 10 + (1LL << 40)); // 只有高32位相同
+    BOOST_CHECK(list.Find((1LL << 40) + 3) == 3);
+    BOOST_CHECK(list.Find(3) == 0 && !list.Contains(3));
+    BOOST_CHECK(list.Count((1LL << 40) + 3) == 10);
+    BOOST_CHECK(list.Contains(1LL << 40) && list.Find(1LL << 40) == 10);
+
+    Sequential_List_Static<double, 40> list_double;
+    for (int i = 0; i < 40; i++)
+        list_double.Element_Insert(i + 1, i == 37 ? -0.0 : std::numeric_limits<double>::quiet_NaN());
+    BOOST_CHECK(list_double.Find(0.0) == 38); // -0.0 == 0.0
+    BOOST_CHECK(list_double.Count(std::numeric_limits<double>::quiet_NaN()) == 0);
+
+    Sequential_List_Small<std::string, 4> list_string{"a", "b", "a"}; // 非算术类型使用标量循环
+    BOOST_CHECK(list_string.Find("b") == 2 && list_string.Count("a") == 2 && !list_string.Contains("c"));
+}
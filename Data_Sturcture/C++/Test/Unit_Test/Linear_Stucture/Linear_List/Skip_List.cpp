@@ -0,0 +1,273 @@
+#define BOOST_TEST_MODULE Skip_List
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_List/Link_List/Skip_List.hpp"
+
+// g++ Skip_List.cpp -g -o Skip_List -lboost_unit_test_framework -std=c++20
+// valgrind --leak-check=full ./Skip_List
+
+BOOST_AUTO_TEST_CASE(Operations)
+{
+    Skip_List<int> list;
+    BOOST_CHECK(list.Is_Empty() && !list.Element_Search(1));
+    for (int element : {2, 10, 12, 8, 1, 6})
+        list.Element_Insert(element);
+    BOOST_CHECK(list.Get_Size() == 6);
+    for (int element : {1, 2, 6, 8, 10, 12})
+        BOOST_CHECK(list.Element_Search(element) == element);
+    BOOST_CHECK(!list.Element_Search(0) && !list.Element_Search(7) && !list.Element_Search(111));
+    BOOST_CHECK_THROW(list.Element_Insert(8), std::runtime_error); // 重复元素
+    BOOST_CHECK_THROW(list.Element_Delete(7), std::runtime_error);
+
+    for (int element : {1, 2, 6, 12, 8, 10})
+        list.Element_Delete(element);
+    BOOST_CHECK(list.Is_Empty() && !list.Element_Search(10));
+    list.Element_Insert(3); // 删空后重新插入
+    BOOST_CHECK(list.Element_Search(3) == 3 && list.Get_Size() == 1);
+}
+
+/// 与std::set对照：随机插入/删除后，查找结果一致
+BOOST_AUTO_TEST_CASE(Random_Operations)
+{
+    Skip_List<int, 0.25f> list;
+    std::set<int> expect;
+    std::mt19937 random{5};
+    for (int i = 0; i < 20000; i++)
+    {
+        int element = static_cast<int>(random() % 2000);
+        if (random() % 3 == 0)
+        {
+            if (expect.erase(element))
+                list.Element_Delete(element);
+            else
+                BOOST_REQUIRE_THROW(list.Element_Delete(element), std::runtime_error);
+        }
+        else
+        {
+            if (expect.insert(element).second)
+                list.Element_Insert(element);
+            else
+                BOOST_REQUIRE_THROW(list.Element_Insert(element), std::runtime_error);
+        }
+        BOOST_REQUIRE(list.Get_Size() == expect.size());
+        int probe = static_cast<int>(random() % 2000);
+        BOOST_REQUIRE(list.Element_Search(probe).has_value() == expect.contains(probe));
+    }
+    for (int element : expect)
+        list.Element_Delete(element);
+    BOOST_CHECK(list.Is_Empty());
+}
+
+/// 节点的指针数组与元素一次分配：每一层都有序，且第i层只链接最高层数不小于i的节点
+BOOST_AUTO_TEST_CASE(Inline_Node_Layout)
+{
+    using Node = Skip_List<int>::Node;
+    BOOST_CHECK(Node::Bytes(3) == Node::Bytes(0) + 3 * (sizeof(Node *) + sizeof(size_t))); // 每层一个指针和一个跨度
+
+    struct Checked_List : Skip_List<int>
+    {
+        bool Check_Structure() const
+        {
+            for (size_t level{}; level <= this->level; ++level)
+                for (Node *node = header[level]; node; node = node->next[level])
+                    if (node->level < level || (node->next[level] && !(node->element < node->next[level]->element)))
+                        return false;
+            return true;
+        }
+    } list;
+    std::mt19937 random{7};
+    for (int i = 0; i < 3000; i++)
+        list.Element_Insert(static_cast<int>(random()));
+    BOOST_CHECK(list.Check_Structure());
+    for (int i = 0; i < 3000; i++)
+        if (int element = static_cast<int>(random()); list.Element_Search(element))
+            list.Element_Delete(element);
+    BOOST_CHECK(list.Check_Structure());
+}
+
+/// 大小分级的节点池：同一级别回收的槽被复用，不同级别互不影响，非平凡析构的元素被正确析构
+BOOST_AUTO_TEST_CASE(Node_Pool_Sized)
+{
+    using Node = List_Node_Skiplist_Inline<std::string>;
+    Policy::Node_Pool_Sized<1024>::Allocator<Node, 8> allocator;
+    Node *low = allocator.Allocate(0, std::string(40, 'a'), 0);
+    Node *high = allocator.Allocate(7, std::string(40, 'b'), 7);
+    BOOST_CHECK(low->element == std::string(40, 'a') && high->level == 7);
+    for (size_t i{}; i <= high->level; ++i)
+        BOOST_CHECK(high->next[i] == nullptr);
+
+    allocator.Deallocate(low, 0);
+    Node *reused = allocator.Allocate(0, std::string(40, 'c'), 0);
+    BOOST_CHECK(reused == low); // 同一级别复用
+    Node *other = allocator.Allocate(1, std::string(40, 'd'), 1);
+    BOOST_CHECK(other != low); // 其它级别不复用
+    std::vector<Node *> nodes;
+    for (int i = 0; i < 100; i++) // 超过一个slab
+        nodes.push_back(allocator.Allocate(7, std::string(40, 'e'), 7));
+    BOOST_CHECK(nodes.back()->element == std::string(40, 'e'));
+
+    for (Node *node : nodes)
+        allocator.Deallocate(node, 7);
+    allocator.Deallocate(high, 7);
+    allocator.Deallocate(reused, 0);
+    allocator.Deallocate(other, 1);
+}
+
+/// 统计每一层的节点数
+template <typename ListType>
+struct Level_Counted : ListType
+{
+    using ListType::ListType;
+    std::vector<size_t> Level_Counts() const
+    {
+        std::vector<size_t> counts;
+        for (size_t level{}; level <= this->level; ++level)
+        {
+            size_t count{};
+            for (auto *node = this->header[level]; node; node = node->next[level])
+                ++count;
+            counts.push_back(count);
+        }
+        return counts;
+    }
+};
+
+/// 层数的随机数源：相同种子得到相同的结构，各层节点数按probable递减，层数不超过max_level-1
+BOOST_AUTO_TEST_CASE(Level_Random_Source)
+{
+    struct Zero_Source // 每次都返回0，层数总是取到上限
+    {
+        uint64_t operator()() { return 0; }
+    };
+
+    Level_Counted<Skip_List<int, 0.5f, Random::Xorshift64>> first{Random::Xorshift64{42}}, second{Random::Xorshift64{42}};
+    Level_Counted<Skip_List<int, 0.25f>> quarter;
+    Level_Counted<Skip_List<int, 0.3f>> other; // 不是1/2^k，逐层比较阈值
+    for (int i = 0; i < 100000; i++)
+    {
+        first.Element_Insert(i);
+        second.Element_Insert(i);
+        quarter.Element_Insert(i);
+        other.Element_Insert(i);
+    }
+    BOOST_CHECK(first.Level_Counts() == second.Level_Counts());
+    for (auto [counts, probable] : {std::pair{first.Level_Counts(), 0.5}, {quarter.Level_Counts(), 0.25}, {other.Level_Counts(), 0.3}})
+        for (size_t level = 1; level < 4; ++level) // 相邻两层的节点数之比接近probable
+            BOOST_CHECK_CLOSE(static_cast<double>(counts[level]) / counts[level - 1], probable, 5);
+
+    Random::Thread_Local<>::Seed(7);
+    uint64_t value = Random::Thread_Local<>{}();
+    Random::Thread_Local<>::Seed(7);
+    BOOST_CHECK(Random::Thread_Local<>{}() == value);
+
+    Level_Counted<Skip_List<int, 0.5f, Zero_Source>> tallest;
+    for (int i = 0; i < 40; i++) // 每次插入最多增加一层
+    {
+        tallest.Element_Insert(i);
+        BOOST_CHECK(tallest.Level_Counts().size() == std::min<size_t>(i + 2, Skip_List<int>::max_level));
+    }
+}
+
+/// 按排名访问：Rank/Select互逆，Range/Range_By_Rank与std::set的区间一致
+BOOST_AUTO_TEST_CASE(Rank_Select_Range)
+{
+    Skip_List<int> list;
+    BOOST_CHECK(list.Rank(1) == 0 && list.Range_By_Rank(1, 10).empty() && list.Range(0, 10).empty());
+    BOOST_CHECK_THROW(list.Select(1), std::out_of_range);
+    for (int element : {50, 10, 40, 20, 30})
+        list.Element_Insert(element);
+    BOOST_CHECK(list.Rank(10) == 1 && list.Rank(30) == 3 && list.Rank(50) == 5 && list.Rank(35) == 0);
+    BOOST_CHECK(list.Select(1) == 10 && list.Select(4) == 40);
+    BOOST_CHECK_THROW(list.Select(0), std::out_of_range);
+    BOOST_CHECK_THROW(list.Select(6), std::out_of_range);
+    BOOST_CHECK(std::ranges::equal(list, std::vector{10, 20, 30, 40, 50}));
+    BOOST_CHECK(std::ranges::equal(list.Range(15, 40), std::vector{20, 30, 40}));
+    BOOST_CHECK(std::ranges::equal(list.Range(10, 10), std::vector{10}));
+    BOOST_CHECK(list.Range(41, 49).empty() && list.Range(40, 20).empty());
+    BOOST_CHECK(std::ranges::equal(list.Range_By_Rank(2, 3), std::vector{20, 30}));
+    BOOST_CHECK(std::ranges::equal(list.Range_By_Rank(4, 100), std::vector{40, 50})); // 截断到size
+    BOOST_CHECK(list.Range_By_Rank(6, 8).empty() && list.Range_By_Rank(3, 2).empty());
+    BOOST_CHECK_THROW(list.Range_By_Rank(0, 2), std::out_of_range);
+
+    Skip_List<int, 0.25f> random_list;
+    std::set<int> expect;
+    std::mt19937 random{11};
+    for (int i = 0; i < 20000; i++)
+    {
+        int element = static_cast<int>(random() % 3000);
+        if (random() % 3 == 0)
+        {
+            if (expect.erase(element))
+                random_list.Element_Delete(element);
+        }
+        else if (expect.insert(element).second)
+            random_list.Element_Insert(element);
+
+        if (i % 100 != 0)
+            continue;
+        size_t rank{};
+        for (int value : expect) // 跨度正确时，每个元素的排名与Select互逆
+        {
+            ++rank;
+            BOOST_REQUIRE(random_list.Rank(value) == rank && random_list.Select(rank) == value);
+        }
+        int lower = static_cast<int>(random() % 3000), upper = lower + static_cast<int>(random() % 100);
+        BOOST_REQUIRE(std::ranges::equal(random_list.Range(lower, upper),
+                                         std::ranges::subrange(expect.lower_bound(lower), expect.upper_bound(upper))));
+        size_t first = random() % (expect.size() + 1) + 1, last = first + random() % 50;
+        auto expect_first = std::next(expect.begin(), std::min(first - 1, expect.size()));
+        auto expect_last = std::next(expect.begin(), std::min(last, expect.size()));
+        BOOST_REQUIRE(std::ranges::equal(random_list.Range_By_Rank(first, last), std::ranges::subrange(expect_first, expect_last)));
+    }
+}
+
+/// 从有序序列批量构造：与逐个插入的结果相同，确定性分配时每层节点数为n/(1/probable)^k
+BOOST_AUTO_TEST_CASE(Bulk_Construct)
+{
+    using List = Level_Counted<Skip_List<int>>;
+    using Assignment = List::Level_Assignment;
+    std::vector<int> elements;
+    for (int i = 0; i < 10000; i++)
+        elements.push_back(i * 3);
+
+    for (Assignment assignment : {Assignment::Random, Assignment::Deterministic})
+    {
+        List list(elements.begin(), elements.end(), assignment);
+        BOOST_CHECK(list.Get_Size() == elements.size() && std::ranges::equal(list, elements));
+        for (size_t rank = 1; rank <= elements.size(); rank += 7)
+            BOOST_REQUIRE(list.Rank(elements[rank - 1]) == rank && list.Select(rank) == elements[rank - 1]);
+        BOOST_CHECK(std::ranges::equal(list.Range(10, 20), std::vector{12, 15, 18}));
+
+        // 构造后可以继续插入删除，插入到末尾时跨度仍然正确
+        list.Element_Insert(1);
+        list.Element_Insert(30000);
+        list.Element_Delete(0);
+        BOOST_CHECK(list.Rank(1) == 1 && list.Rank(30000) == elements.size() + 1 && list.Select(2) == 3);
+    }
+
+    List deterministic(elements.begin(), elements.end(), Assignment::Deterministic);
+    std::vector<size_t> counts = deterministic.Level_Counts();
+    BOOST_CHECK(counts.size() == 14); // 2^13 <= 10000 < 2^14
+    for (size_t level = 0; level < counts.size(); ++level)
+        BOOST_CHECK(counts[level] == elements.size() >> level);
+
+    Level_Counted<Skip_List<int, 0.25f>> quarter(elements.begin(), elements.end(), Skip_List<int, 0.25f>::Level_Assignment::Deterministic);
+    counts = quarter.Level_Counts();
+    BOOST_CHECK(counts.size() == 7 && counts[1] == 2500 && counts[6] == 2); // 4^6 <= 10000 < 4^7
+
+    List empty(elements.begin(), elements.begin());
+    BOOST_CHECK(empty.Is_Empty() && empty.Range_By_Rank(1, 10).empty());
+    empty.Element_Insert(5);
+    BOOST_CHECK(empty.Rank(5) == 1 && empty.Select(1) == 5);
+
+    std::vector<int> unsorted{1, 3, 3, 4};
+    BOOST_CHECK_THROW(List(unsorted.begin(), unsorted.end()), std::invalid_argument);
+}
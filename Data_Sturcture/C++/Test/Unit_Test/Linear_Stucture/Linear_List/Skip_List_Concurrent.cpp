@@ -0,0 +1,121 @@
+#define BOOST_TEST_MODULE Skip_List_Concurrent
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_List/Link_List/Skip_List_Concurrent.hpp"
+
+// g++ Skip_List_Concurrent.cpp -g -o Skip_List_Concurrent -lboost_unit_test_framework -std=c++20 -pthread
+// ./Skip_List_Concurrent
+// 检查数据竞争：加上 -fsanitize=thread
+
+BOOST_AUTO_TEST_CASE(Operations)
+{
+    Skip_List_Concurrent<int> list;
+    BOOST_CHECK(list.Is_Empty() && !list.Element_Search(1));
+    for (int element : {2, 10, 12, 8, 1, 6})
+        list.Element_Insert(element);
+    BOOST_CHECK(list.Get_Size() == 6);
+    for (int element : {1, 2, 6, 8, 10, 12})
+        BOOST_CHECK(list.Element_Search(element) == element);
+    BOOST_CHECK(!list.Contains(0) && !list.Contains(7) && !list.Contains(111));
+    BOOST_CHECK(!list.Try_Insert(8) && !list.Try_Delete(7));
+    BOOST_CHECK_THROW(list.Element_Insert(8), std::runtime_error);
+    BOOST_CHECK_THROW(list.Element_Delete(7), std::runtime_error);
+
+    for (int element : {1, 2, 6, 12, 8, 10})
+        BOOST_CHECK(list.Try_Delete(element));
+    BOOST_CHECK(list.Is_Empty() && !list.Contains(10));
+    BOOST_CHECK(list.Try_Insert(3) && list.Contains(3));
+}
+
+/// 单线程随机操作，与std::set对照
+BOOST_AUTO_TEST_CASE(Random_Operations)
+{
+    Skip_List_Concurrent<int, 0.25f> list;
+    std::set<int> expect;
+    std::mt19937 random{5};
+    for (int i = 0; i < 20000; i++)
+    {
+        int element = static_cast<int>(random() % 2000);
+        if (random() % 3 == 0)
+            BOOST_REQUIRE(list.Try_Delete(element) == (expect.erase(element) == 1));
+        else
+            BOOST_REQUIRE(list.Try_Insert(element) == expect.insert(element).second);
+        int probe = static_cast<int>(random() % 2000);
+        BOOST_REQUIRE(list.Contains(probe) == expect.contains(probe));
+    }
+    BOOST_CHECK(list.Get_Size() == expect.size());
+}
+
+/// 每个线程操作自己的键(键%线程数==线程号)，同时与其他线程交错，结果与单线程的std::set一致
+BOOST_AUTO_TEST_CASE(Concurrent_Disjoint)
+{
+    constexpr int thread_count = 4, key_range = 4000;
+    Skip_List_Concurrent<int> list;
+    std::vector<std::set<int>> expects(thread_count);
+    std::atomic<bool> failed{};
+    std::vector<std::thread> threads;
+    for (int id = 0; id < thread_count; id++)
+        threads.emplace_back([&, id]()
+        {
+            std::mt19937 random(id);
+            std::set<int> &expect = expects[id];
+            for (int i = 0; i < 20000; i++)
+            {
+                int element = static_cast<int>(random() % (key_range / thread_count)) * thread_count + id;
+                bool result = random() % 2 ? list.Try_Delete(element) == (expect.erase(element) == 1)
+                                           : list.Try_Insert(element) == expect.insert(element).second;
+                if (!result || list.Contains(element) != expect.contains(element))
+                    failed = true;
+            }
+        });
+    for (auto &thread : threads)
+        thread.join();
+    BOOST_CHECK(!failed);
+
+    size_t size{};
+    for (int element = 0; element < key_range; element++)
+    {
+        bool expect = expects[element % thread_count].contains(element);
+        size += expect;
+        BOOST_REQUIRE(list.Contains(element) == expect);
+    }
+    BOOST_CHECK(list.Get_Size() == size);
+}
+
+/// 所有线程争抢同一组键：每个键同一时刻只有一次插入成功，成功的插入与删除次数之差等于最终的元素个数
+BOOST_AUTO_TEST_CASE(Concurrent_Contended)
+{
+    constexpr int thread_count = 4, key_range = 64;
+    Skip_List_Concurrent<int> list;
+    std::atomic<long> inserted{}, deleted{};
+    std::vector<std::thread> threads;
+    for (int id = 0; id < thread_count; id++)
+        threads.emplace_back([&, id]()
+        {
+            std::mt19937 random(id + 100);
+            for (int i = 0; i < 50000; i++)
+            {
+                int element = static_cast<int>(random() % key_range);
+                if (random() % 2)
+                    inserted += list.Try_Insert(element);
+                else
+                    deleted += list.Try_Delete(element);
+                list.Contains(static_cast<int>(random() % key_range));
+            }
+        });
+    for (auto &thread : threads)
+        thread.join();
+
+    long size{};
+    for (int element = 0; element < key_range; element++)
+        size += list.Contains(element);
+    BOOST_CHECK(inserted - deleted == size);
+    BOOST_CHECK(list.Get_Size() == static_cast<size_t>(size));
+}
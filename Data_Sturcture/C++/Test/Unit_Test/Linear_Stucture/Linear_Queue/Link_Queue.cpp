@@ -10,6 +10,7 @@
 #include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Linked/Link_Queue.hpp"
 
 #include "../../../../Test/Unit_Test/Test_Element.hpp"
+#include "../../../../Test/Unit_Test/Counted.hpp"
 
 // g++ Link_Queue.cpp -g -o Link_Queue -lboost_unit_test_framework -std=c++20
 // valgrind --leak-check=full ./Link_Queue
@@ -150,3 +151,53 @@ BOOST_AUTO_TEST_CASE(Copy_Control)
         Check_Element<Link_Queue<int>>(queue_move_assign, list);
     }
 }
+
+#include <string>
+BOOST_AUTO_TEST_CASE(Node_Allocator)
+{
+    using Queue = Link_Queue<std::string, List_Node_SingleWay<std::string>, Policy::Node_Pool<16>>;
+    Queue queue;
+    int enqueued{}, dequeued{};
+    for (int round = 0; round < 3; round++)
+    { // 出队的节点被之后的入队复用
+        for (int i = 0; i < 40; i++)
+            queue.Element_Enqueue(std::to_string(enqueued++));
+        for (int i = 0; i < 30; i++)
+        {
+            BOOST_CHECK(queue.Get_Front() == std::to_string(dequeued++));
+            queue.Element_Dequeue();
+        }
+    }
+    BOOST_CHECK(queue.Get_Size() == 30);
+
+    Queue queue_copy(queue);
+    BOOST_CHECK(queue_copy.Get_Size() == 30 && queue_copy.Get_Front() == queue.Get_Front());
+    Queue queue_move(std::move(queue));
+    BOOST_CHECK(queue.Is_Empty() && queue_move.Get_Size() == 30);
+    queue_copy = std::move(queue_move);
+    BOOST_CHECK(queue_move.Is_Empty() && queue_copy.Get_Size() == 30);
+    queue_copy.Clear(); // 整体释放
+    queue_copy.Element_Enqueue("reuse");
+    BOOST_CHECK(queue_copy.Get_Front() == "reuse" && queue_copy.Get_Size() == 1);
+}
+
+/// 拷贝构造中途元素拷贝抛出异常：已拷贝的节点被回收(ASan检查)，元素被析构
+template <typename AllocatorPolicy>
+void _Copy_Exception_Safety()
+{
+    using Queue = Link_Queue<Throw_On_Copy, List_Node_SingleWay<Throw_On_Copy>, AllocatorPolicy>;
+    {
+        Queue queue;
+        queue.Element_Enqueue(Throw_On_Copy{1});
+        queue.Element_Enqueue(Throw_On_Copy{2});
+        queue.Element_Enqueue(Throw_On_Copy{-1});
+        BOOST_CHECK_THROW(Queue{queue}, std::runtime_error);
+        BOOST_CHECK(Counted::alive == 3 && queue.Get_Size() == 3);
+    }
+    BOOST_CHECK(Counted::alive == 0);
+}
+BOOST_AUTO_TEST_CASE(Copy_Exception_Safety)
+{
+    _Copy_Exception_Safety<Policy::Node_New>();
+    _Copy_Exception_Safety<Policy::Node_Pool<2>>();
+}
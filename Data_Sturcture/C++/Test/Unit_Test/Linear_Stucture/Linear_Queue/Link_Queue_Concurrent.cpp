@@ -0,0 +1,105 @@
+#define BOOST_TEST_MODULE Link_Queue_Concurrent
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Linked/Link_Queue.hpp"
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Linked/Link_Queue_Concurrent.hpp"
+#include "Producers_Consumers.hpp"
+#include "../../../../Test/Unit_Test/Counted.hpp"
+
+// g++ Link_Queue_Concurrent.cpp -g -o Link_Queue_Concurrent -lboost_unit_test_framework -std=c++20 -pthread
+// valgrind --leak-check=full ./Link_Queue_Concurrent
+// 检查数据竞争：加上 -fsanitize=thread
+
+BOOST_AUTO_TEST_CASE(Operations)
+{
+    Link_Queue_Concurrent<int> queue;
+    BOOST_CHECK(queue.Is_Empty() && queue.Get_Size() == 0);
+    BOOST_CHECK_THROW(queue.Get_Front(), std::runtime_error);
+    BOOST_CHECK_THROW(queue.Element_Dequeue(), std::runtime_error);
+
+    for (int i = 1; i <= 1000; i++) // 无界
+        queue.Element_Enqueue(i);
+    BOOST_CHECK(queue.Get_Size() == 1000 && queue.Get_Front() == 1);
+
+    int element{};
+    for (int i = 1; i <= 500; i++)
+    {
+        BOOST_REQUIRE(queue.Try_Dequeue(element) && element == i);
+        queue.Element_Enqueue(i + 1000); // 出队的节点经回收后被复用
+    }
+    BOOST_CHECK(queue.Get_Size() == 1000 && queue.Get_Front() == 501);
+    queue.Element_Dequeue();
+    BOOST_CHECK(queue.Get_Front() == 502);
+    queue.Clear();
+    BOOST_CHECK(queue.Is_Empty() && !queue.Try_Dequeue(element));
+    queue.Element_Enqueue(7);
+    BOOST_CHECK(queue.Get_Size() == 1 && queue.Get_Front() == 7);
+}
+
+/// 出队的旧哨兵交给回收域，纪元推进后才析构：存活的节点数不随出队次数增长，队列析构后剩余的也会被释放
+BOOST_AUTO_TEST_CASE(Retire_Reclamation)
+{
+    {
+        Link_Queue_Concurrent<Counted_Default> queue; // 哨兵需要默认构造
+        BOOST_CHECK(Counted::alive == 1); // 哨兵
+        for (int i = 0; i < 10000; i++)
+        {
+            queue.Element_Enqueue(Counted_Default{i});
+            queue.Element_Dequeue();
+        }
+        // 回收域每回收64个对象推进一次纪元，只有最近几个纪元的旧哨兵还未释放
+        BOOST_CHECK(Counted::alive < 1 + 4 * 64);
+
+        Counted_Default element;
+        queue.Element_Enqueue(Counted_Default{7});
+        BOOST_CHECK(queue.Try_Dequeue(element) && element.value == 7 && queue.Is_Empty());
+    }
+    // 队列析构时已回收的节点仍在回收袋中，之后的回收推进纪元时释放
+    Link_Queue_Concurrent<int> queue;
+    for (int i = 0; i < 1000; i++)
+    {
+        queue.Element_Enqueue(i);
+        queue.Element_Dequeue();
+    }
+    BOOST_CHECK(Counted::alive == 0);
+}
+
+/// 线程缓存策略也可以用于单线程的Link_Queue
+BOOST_AUTO_TEST_CASE(Node_Thread_Cache)
+{
+    using Queue = Link_Queue<std::string, List_Node_SingleWay<std::string>, Policy::Node_Thread_Cache<16>>;
+    Queue queue;
+    int enqueued{}, dequeued{};
+    for (int round = 0; round < 3; round++)
+    { // 出队的节点进入线程缓存，之后的入队复用，每满16个整批交给全局仓库
+        for (int i = 0; i < 40; i++)
+            queue.Element_Enqueue(std::to_string(enqueued++));
+        for (int i = 0; i < 30; i++)
+        {
+            BOOST_CHECK(queue.Get_Front() == std::to_string(dequeued++));
+            queue.Element_Dequeue();
+        }
+    }
+    Queue queue_copy(queue);
+    BOOST_CHECK(queue_copy.Get_Size() == 30 && queue_copy.Get_Front() == queue.Get_Front());
+
+    // 在一个线程中分配、在另一个线程中回收，节点进入回收线程的缓存，线程退出时释放
+    auto *node = Policy::Node_Thread_Cache<>::Allocator<List_Node_SingleWay<std::string>>::Allocate(std::string(32, 'x'));
+    std::thread([node]()
+    { Policy::Node_Thread_Cache<>::Allocator<List_Node_SingleWay<std::string>>::Deallocate(node); }).join();
+}
+
+/// 线程缓存只有4个槽：生产者分配的节点在消费者线程中经回收域释放，频繁整批交给全局仓库，再被生产者取回复用
+BOOST_AUTO_TEST_CASE(Producers_Consumers_Depot)
+{
+    Link_Queue_Concurrent<int, Policy::Node_Thread_Cache<4>> queue;
+    BOOST_CHECK(Producers_Consumers(4, 4, 50000,
+                                    [&](int element) { queue.Element_Enqueue(element); return true; },
+                                    [&](int &element) { return queue.Try_Dequeue(element); }));
+    BOOST_CHECK(queue.Is_Empty() && queue.Get_Size() == 0);
+}
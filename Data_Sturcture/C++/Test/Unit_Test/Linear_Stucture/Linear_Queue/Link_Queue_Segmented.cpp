@@ -0,0 +1,125 @@
+#define BOOST_TEST_MODULE Link_Queue_Segmented
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Linked/Link_Queue_Segmented.hpp"
+#include "../../../../Test/Unit_Test/Counted.hpp"
+
+// g++ Link_Queue_Segmented.cpp -g -o Link_Queue_Segmented -lboost_unit_test_framework -std=c++20
+// valgrind --leak-check=full ./Link_Queue_Segmented
+
+BOOST_AUTO_TEST_CASE(Operations)
+{
+    Link_Queue_Segmented<int, 4> queue;
+    BOOST_CHECK(queue.Is_Empty() && queue.Get_Size() == 0);
+    BOOST_CHECK_THROW(queue.Get_Front(), std::runtime_error);
+    BOOST_CHECK_THROW(queue.Element_Dequeue(), std::runtime_error);
+
+    for (int i = 1; i <= 10; i++) // 跨越3个块
+        queue.Element_Enqueue(i);
+    BOOST_CHECK(queue.Get_Size() == 10 && queue.Get_Front() == 1);
+    for (int i = 1; i <= 10; i++)
+    {
+        BOOST_REQUIRE(queue.Get_Front() == i);
+        queue.Element_Dequeue();
+    }
+    BOOST_CHECK(queue.Is_Empty());
+
+    int enqueued{1}, dequeued{1};
+    for (int round = 0; round < 100; round++) // 队列长度在块边界两侧变化，取空的块被回收复用
+    {
+        for (int i = 0; i < 7; i++)
+            queue.Element_Enqueue(enqueued++);
+        for (int i = 0; i < 5; i++)
+        {
+            BOOST_REQUIRE(queue.Get_Front() == dequeued++);
+            queue.Element_Dequeue();
+        }
+    }
+    BOOST_CHECK(queue.Get_Size() == 200 && queue.Get_Front() == dequeued);
+    queue.Clear();
+    BOOST_CHECK(queue.Is_Empty());
+    queue.Element_Enqueue(7);
+    BOOST_CHECK(queue.Get_Size() == 1 && queue.Get_Front() == 7);
+}
+
+/// 取空的块回收到空闲链表后再复用：块中只有[front_index,rear_index)内的元素存活，复用时不会重复析构或遗漏
+BOOST_AUTO_TEST_CASE(Block_Recycling)
+{
+    {
+        Link_Queue_Segmented<Counted, 4> queue;
+        int enqueued{}, dequeued{};
+        for (int round = 0; round < 50; round++) // 长度在块边界两侧变化，块不断取空、回收、复用
+        {
+            for (int i = 0; i < 7; i++)
+                queue.Element_Enqueue(Counted{enqueued++});
+            for (int i = 0; i < 6; i++)
+            {
+                BOOST_REQUIRE(queue.Get_Front().value == dequeued++);
+                queue.Element_Dequeue();
+            }
+            BOOST_REQUIRE(Counted::alive == static_cast<int>(queue.Get_Size()));
+        }
+        while (!queue.Is_Empty()) // 取空后下标回到块头
+            queue.Element_Dequeue();
+        BOOST_CHECK(Counted::alive == 0);
+        for (int i = 0; i < 9; i++)
+            queue.Element_Enqueue(Counted{i});
+        Link_Queue_Segmented<Counted, 4> copy(queue);
+        BOOST_CHECK(Counted::alive == 18);
+        queue.Clear();
+        BOOST_CHECK(Counted::alive == 9 && copy.Get_Front().value == 0);
+    }
+    BOOST_CHECK(Counted::alive == 0);
+}
+
+BOOST_AUTO_TEST_CASE(Copy_Control)
+{
+    using Queue = Link_Queue_Segmented<std::string, 4>;
+    Queue queue;
+    for (int i = 0; i < 10; i++)
+        queue.Element_Enqueue(std::to_string(i));
+    queue.Element_Dequeue();
+
+    auto Check = [](Queue copy, int first, int last)
+    {
+        BOOST_CHECK(copy.Get_Size() == static_cast<size_t>(last - first + 1));
+        for (int i = first; i <= last; i++)
+        {
+            BOOST_CHECK(copy.Get_Front() == std::to_string(i));
+            copy.Element_Dequeue();
+        }
+    };
+    Queue queue_copy(queue);
+    Check(queue_copy, 1, 9);
+    Queue queue_assign;
+    queue_assign.Element_Enqueue("old");
+    queue_assign = queue;
+    Check(queue_assign, 1, 9);
+
+    Queue queue_move(std::move(queue));
+    BOOST_CHECK(queue.Is_Empty());
+    Check(queue_move, 1, 9);
+    queue = std::move(queue_move);
+    BOOST_CHECK(queue_move.Is_Empty());
+    Check(queue, 1, 9);
+    queue_move.Element_Enqueue("reuse"); // 被移动后仍可使用
+    BOOST_CHECK(queue_move.Get_Front() == "reuse");
+}
+
+/// 入队时元素构造抛出异常，队列保持不变
+BOOST_AUTO_TEST_CASE(Exception_Safety)
+{
+    Link_Queue_Segmented<Throw_On_Copy, 2> queue;
+    Throw_On_Copy good{1}, bad{-1};
+    queue.Element_Enqueue(good);
+    queue.Element_Enqueue(good);
+    BOOST_CHECK_THROW(queue.Element_Enqueue(bad), std::runtime_error); // 需要新块时抛出
+    BOOST_CHECK(queue.Get_Size() == 2);
+    queue.Element_Enqueue(Throw_On_Copy{3});
+    queue.Element_Dequeue();
+    queue.Element_Dequeue();
+    BOOST_CHECK(queue.Get_Size() == 1 && queue.Get_Front().value == 3);
+}
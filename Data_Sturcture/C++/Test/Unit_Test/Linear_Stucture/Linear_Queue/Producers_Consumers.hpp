@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/// 多生产者多消费者的压力测试，供并发队列的单元测试共用
+/// 生产者id入队id*count+i(i递增)，消费者取出所有元素后检查：
+/// 		每个元素恰好被取出一次；同一消费者取到的同一生产者的元素按入队顺序递增
+/// @param try_enqueue bool(int)，队满时返回false，由生产者yield后重试
+/// @param try_dequeue bool(int&)，队空时返回false
+/// @return 两项检查是否都通过
+template <typename Try_Enqueue, typename Try_Dequeue>
+bool Producers_Consumers(int producer_count, int consumer_count, int count, Try_Enqueue &&try_enqueue, Try_Dequeue &&try_dequeue)
+{
+    std::vector<std::atomic<int>> received(producer_count * count);
+    std::atomic<bool> ordered{true};
+    std::atomic<int> remaining{producer_count * count};
+
+    std::vector<std::thread> threads;
+    for (int id = 0; id < producer_count; id++)
+        threads.emplace_back([&, id]()
+        {
+            for (int i = 0; i < count; i++)
+                while (!try_enqueue(id * count + i))
+                    std::this_thread::yield();
+        });
+    for (int id = 0; id < consumer_count; id++)
+        threads.emplace_back([&]()
+        {
+            std::vector<int> last(producer_count, -1);
+            int element{};
+            while (remaining.load() > 0)
+            {
+                if (!try_dequeue(element))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                remaining.fetch_sub(1);
+                received[element].fetch_add(1);
+                int producer = element / count;
+                if (element <= last[producer])
+                    ordered.store(false);
+                last[producer] = element;
+            }
+        });
+    for (auto &thread : threads)
+        thread.join();
+
+    bool exactly_once{true};
+    for (auto &times : received)
+        exactly_once &= times.load() == 1;
+    return exactly_once && ordered.load();
+}
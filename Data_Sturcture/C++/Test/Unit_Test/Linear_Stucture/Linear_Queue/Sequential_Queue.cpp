@@ -6,10 +6,13 @@
 
 #include <limits>
 #include <iostream>
+#include <sstream>
+#include <string>
 
 #include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Sequential/Sequential_Queue.hpp"
 
 #include "../../../../Test/Unit_Test/Test_Element.hpp"
+#include "../../../../Test/Unit_Test/Counted.hpp"
 
 // g++ Sequential_Queue.cpp -g -o Sequential_Queue -lboost_unit_test_framework -std=c++20
 // valgrind --leak-check=full ./Sequential_Queue
@@ -261,4 +264,153 @@ BOOST_AUTO_TEST_CASE(Copy_Control)
         test(queue_move_construct, 0, 5);
         Check_Element<Sequential_Queue_Tag<int, 5>>(queue_move_assign, list);
     }
-}
\ No newline at end of file
+}
+/// 空闲位置没有构造元素，每个元素恰好析构一次
+template <typename QueueType>
+void _Uninitialized_Storage()
+{
+    {
+        QueueType queue;
+        BOOST_CHECK(Counted::alive == 0);
+        for (int i = 1; i <= 3; i++)
+            queue.Element_Enqueue(Counted{i});
+        queue.Element_Dequeue();
+        queue.Element_Dequeue();
+        for (int i = 4; i <= 6; i++) // 绕回数组头部
+            queue.Element_Enqueue(Counted{i});
+        BOOST_CHECK(Counted::alive == 4 && queue.Get_Front().value == 3);
+
+        QueueType queue_copy(queue);
+        BOOST_CHECK(Counted::alive == 8 && queue_copy.Get_Front().value == 3);
+        QueueType queue_move(std::move(queue));
+        BOOST_CHECK(Counted::alive == 8 && queue.Is_Empty() && queue_move.Get_Front().value == 3);
+
+        queue_move.Element_Dequeue();
+        queue_copy = queue_move;
+        BOOST_CHECK(Counted::alive == 6 && queue_copy.Get_Size() == 3 && queue_copy.Get_Front().value == 4);
+        queue_copy.Clear();
+        BOOST_CHECK(Counted::alive == 3);
+        queue_copy.Element_Enqueue(Counted{9});
+        BOOST_CHECK(queue_copy.Get_Front().value == 9);
+    }
+    BOOST_CHECK(Counted::alive == 0);
+}
+BOOST_AUTO_TEST_CASE(Uninitialized_Storage)
+{
+    _Uninitialized_Storage<Sequential_Queue_Redundancy<Counted, 4>>();
+    _Uninitialized_Storage<Sequential_Queue_Tag<Counted, 4>>();
+}
+/// Queue_Show只输出构造过的元素，空闲位置只显示下标
+template <typename QueueType>
+void _Show_Live_Only(const std::string &expected)
+{
+    QueueType queue;
+    for (const char *element : {"a", "b", "c"})
+        queue.Element_Enqueue(element);
+    queue.Element_Dequeue();
+    queue.Element_Dequeue();
+    queue.Element_Enqueue("d");
+    queue.Element_Enqueue("e");
+
+    std::ostringstream output;
+    std::streambuf *buffer = std::cout.rdbuf(output.rdbuf());
+    queue.Queue_Show("");
+    std::cout.rdbuf(buffer);
+    BOOST_CHECK(output.str().find(expected) != std::string::npos);
+}
+BOOST_AUTO_TEST_CASE(Show_Live_Only)
+{
+    _Show_Live_Only<Sequential_Queue_Redundancy<std::string, 4>>("Queue-[0:]-[1:]-[2:c]-[3:d]-[4:e]-End");
+    _Show_Live_Only<Sequential_Queue_Tag<std::string, 4>>("Queue-[0:e]-[1:]-[2:c]-[3:d]-End");
+}
+
+#include <utility> //as_const
+#include <vector>
+template <template <typename, size_t> class QueueType>
+void _Bulk()
+{
+    { // int：队满/队空时只传输部分元素，绕回数组头部时分两段
+        QueueType<int, 4> queue;
+        std::vector<int> input{1, 2, 3, 4, 5, 6};
+        BOOST_CHECK(queue.Enqueue_Bulk(std::as_const(input)) == 4); // 只放得下4个
+        BOOST_CHECK(queue.Is_Full() && queue.Get_Size() == 4 && queue.Get_Front() == 1);
+        BOOST_CHECK(queue.Enqueue_Bulk(std::as_const(input)) == 0);
+
+        std::vector<int> output(3);
+        BOOST_CHECK(queue.Dequeue_Bulk(output) == 3);
+        BOOST_CHECK((output == std::vector<int>{1, 2, 3}) && !queue.Is_Full() && queue.Get_Front() == 4);
+        BOOST_CHECK(queue.Enqueue_Bulk(std::span<const int>(input).subspan(4)) == 2); // 跨过数组末尾
+        queue.Element_Enqueue(7);
+        BOOST_CHECK(queue.Is_Full() && queue.Get_Size() == 4);
+
+        output.assign(6, 0);
+        BOOST_CHECK(queue.Dequeue_Bulk(output) == 4); // 跨过数组末尾，只有4个
+        BOOST_CHECK((output == std::vector<int>{4, 5, 6, 7, 0, 0}) && queue.Is_Empty() && !queue.Is_Full());
+        BOOST_CHECK(queue.Dequeue_Bulk(output) == 0);
+        queue.Element_Enqueue(8); // 批量操作后单个入队出队的下标仍然正确
+        BOOST_CHECK(queue.Get_Front() == 8 && queue.Get_Size() == 1);
+    }
+    { // 通过基类引用调用批量操作，派生类的判满状态同样被维护
+        QueueType<int, 4> queue;
+        Storage::Sequential_Queue<int, 4> &base = queue;
+        std::vector<int> input{1, 2, 3, 4};
+        BOOST_CHECK(base.Enqueue_Bulk(std::as_const(input)) == 4);
+        BOOST_CHECK(queue.Is_Full() && base.Is_Full());
+        BOOST_CHECK_THROW(queue.Element_Enqueue(5), std::runtime_error);
+        BOOST_CHECK(queue.Get_Size() == 4);
+
+        std::vector<int> output(2);
+        BOOST_CHECK(base.Dequeue_Bulk(output) == 2 && !queue.Is_Full());
+        queue.Element_Enqueue(5);
+        queue.Element_Enqueue(6);
+        BOOST_CHECK(queue.Is_Full() && queue.Get_Size() == 4 && queue.Get_Front() == 3);
+        BOOST_CHECK_THROW(queue.Element_Enqueue(7), std::runtime_error);
+    }
+    { // 非平凡元素：入队拷贝构造，出队移动后析构
+        QueueType<Counted, 4> queue;
+        std::vector<Counted> input{Counted{1}, Counted{2}, Counted{3}};
+        queue.Element_Enqueue(Counted{0});
+        queue.Element_Enqueue(Counted{0});
+        queue.Element_Dequeue();
+        queue.Element_Dequeue();
+        BOOST_CHECK(queue.Enqueue_Bulk(std::as_const(input)) == 3 && Counted::alive == 6);
+        std::vector<Counted> output(2, Counted{0});
+        BOOST_CHECK(queue.Dequeue_Bulk(output) == 2 && Counted::alive == 6);
+        BOOST_CHECK(output[0].value == 1 && output[1].value == 2 && queue.Get_Front().value == 3);
+    }
+    BOOST_CHECK(Counted::alive == 0);
+    { // 可修改的span：元素移动入队，放不下的元素不变
+        QueueType<std::string, 4> queue;
+        queue.Element_Enqueue("front");
+        queue.Element_Enqueue("front");
+        queue.Element_Dequeue();
+        std::vector<std::string> input{std::string(32, 'a'), std::string(32, 'b'), std::string(32, 'c'), std::string(32, 'd')};
+        BOOST_CHECK(queue.Enqueue_Bulk(std::span(input)) == 3 && queue.Is_Full()); // 只放得下3个
+        BOOST_CHECK(input[0].empty() && input[2].empty() && input[3] == std::string(32, 'd'));
+        std::vector<std::string> output(4);
+        BOOST_CHECK(queue.Dequeue_Bulk(output) == 4 && output[1] == std::string(32, 'a') && output[3] == std::string(32, 'c'));
+    }
+    { // 第二段拷贝抛出异常：第一段已经入队，判满状态与size一致，之后的操作正常
+        QueueType<Throw_On_Copy, 4> queue;
+        for (size_t i = 0; i + 2 < queue.Get_Capcity(); i++) // 数组末尾只剩2个位置
+        {
+            queue.Element_Enqueue(Throw_On_Copy{0});
+            queue.Element_Dequeue();
+        }
+        std::vector<Throw_On_Copy> input;
+        for (int value : {1, 2, -1, 3})
+            input.emplace_back(value);
+        BOOST_CHECK_THROW(queue.Enqueue_Bulk(std::as_const(input)), std::runtime_error);
+        BOOST_CHECK(queue.Get_Size() == 2 && !queue.Is_Full() && queue.Get_Front().value == 1 && Counted::alive == 6);
+        queue.Element_Enqueue(Throw_On_Copy{4});
+        queue.Element_Enqueue(Throw_On_Copy{5});
+        BOOST_CHECK(queue.Is_Full() && queue.Get_Size() == 4);
+        BOOST_CHECK_THROW(queue.Element_Enqueue(Throw_On_Copy{6}), std::runtime_error);
+    }
+    BOOST_CHECK(Counted::alive == 0);
+}
+BOOST_AUTO_TEST_CASE(Bulk)
+{
+    _Bulk<Sequential_Queue_Redundancy>();
+    _Bulk<Sequential_Queue_Tag>();
+}
@@ -0,0 +1,137 @@
+#define BOOST_TEST_MODULE Sequential_Queue_Growable
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Sequential/Sequential_Queue_Growable.hpp"
+#include "../../../../Test/Unit_Test/Counted.hpp"
+
+// g++ Sequential_Queue_Growable.cpp -g -o Sequential_Queue_Growable -lboost_unit_test_framework -std=c++20
+// valgrind --leak-check=full ./Sequential_Queue_Growable
+
+BOOST_AUTO_TEST_CASE(Operations)
+{
+    Sequential_Queue_Growable<int> queue(3); // 初始容量取整为4，第一次入队时才分配
+    BOOST_CHECK(queue.Is_Empty() && queue.Get_Capcity() == 0);
+    BOOST_CHECK_THROW(queue.Get_Front(), std::runtime_error);
+    BOOST_CHECK_THROW(queue.Element_Dequeue(), std::runtime_error);
+
+    for (int i = 1; i <= 3; i++)
+        queue.Element_Enqueue(i);
+    queue.Element_Dequeue();
+    queue.Element_Dequeue();
+    for (int i = 4; i <= 6; i++) // 绕回数组头部：[3] 4 5 6 -> front=2
+        queue.Element_Enqueue(i);
+    BOOST_CHECK(queue.Get_Capcity() == 4 && queue.Get_Size() == 4);
+    queue.Element_Enqueue(7); // 队满扩容，两段按顺序移动到新数组开头
+    BOOST_CHECK(queue.Get_Capcity() == 8 && queue.Get_Size() == 5);
+    for (int i = 8; i <= 100; i++)
+        queue.Element_Enqueue(i);
+    BOOST_CHECK(queue.Get_Capcity() == 128 && queue.Get_Size() == 98);
+    for (int i = 3; i <= 100; i++)
+    {
+        BOOST_REQUIRE(queue.Get_Front() == i);
+        queue.Element_Dequeue();
+    }
+    BOOST_CHECK(queue.Is_Empty() && queue.Get_Capcity() == 128); // 默认不自动收缩
+
+    queue.Element_Enqueue(1);
+    queue.Shrink_To_Fit();
+    BOOST_CHECK(queue.Get_Capcity() == 4 && queue.Get_Front() == 1);
+    queue.Reserve(1000);
+    BOOST_CHECK(queue.Get_Capcity() == 1024 && queue.Get_Front() == 1);
+    queue.Clear();
+    BOOST_CHECK(queue.Is_Empty() && queue.Get_Capcity() == 1024);
+}
+
+BOOST_AUTO_TEST_CASE(Shrink)
+{
+    Sequential_Queue_Growable<int, true> queue(4);
+    for (int i = 0; i < 64; i++)
+        queue.Element_Enqueue(i);
+    BOOST_CHECK(queue.Get_Capcity() == 64);
+    for (int i = 0; i < 48; i++)
+        queue.Element_Dequeue();
+    BOOST_CHECK(queue.Get_Capcity() == 32 && queue.Get_Front() == 48); // 剩16个=1/4时减半
+    for (int i = 48; i < 63; i++)
+    {
+        BOOST_REQUIRE(queue.Get_Front() == i);
+        queue.Element_Dequeue();
+    }
+    BOOST_CHECK(queue.Get_Capcity() == 4 && queue.Get_Front() == 63); // 不小于初始容量
+}
+
+/// 扩容和收缩时两段元素移动到新数组：每次搬运后存活的元素恰好是队列中的元素，顺序不变
+BOOST_AUTO_TEST_CASE(Relocation)
+{
+    {
+        Sequential_Queue_Growable<Counted, true> queue(2);
+        int enqueued{}, dequeued{};
+        for (int round = 0; round < 6; round++) // 每轮先出队一部分使环形区间绕回，再入队到扩容
+        {
+            for (int i = 0; i < (2 << round); i++)
+                queue.Element_Enqueue(Counted{enqueued++});
+            for (int i = 0; i < (1 << round); i++)
+            {
+                BOOST_REQUIRE(queue.Get_Front().value == dequeued++);
+                queue.Element_Dequeue();
+            }
+            BOOST_REQUIRE(Counted::alive == static_cast<int>(queue.Get_Size()));
+        }
+        BOOST_CHECK(queue.Get_Capcity() == 128 && queue.Get_Size() == 63);
+
+        while (queue.Get_Size() < queue.Get_Capcity())
+            queue.Element_Enqueue(Counted{enqueued++});
+        queue.Element_Enqueue(queue.Get_Front()); // 引用队列中的元素，恰好触发扩容
+        BOOST_CHECK(queue.Get_Capcity() == 256 && Counted::alive == 129);
+        int aliased = dequeued;
+
+        while (queue.Get_Size() > 1) // 自动收缩到初始容量
+        {
+            BOOST_REQUIRE(queue.Get_Front().value == dequeued++);
+            queue.Element_Dequeue();
+        }
+        BOOST_CHECK(queue.Get_Capcity() == 2 && queue.Get_Front().value == aliased && Counted::alive == 1);
+    }
+    BOOST_CHECK(Counted::alive == 0);
+}
+
+BOOST_AUTO_TEST_CASE(Copy_Control)
+{
+    using Queue = Sequential_Queue_Growable<Counted>;
+    {
+        Queue queue(2);
+        for (int i = 0; i < 10; i++)
+            queue.Element_Enqueue(Counted{i});
+        queue.Element_Dequeue();
+
+        Queue queue_copy(queue);
+        BOOST_CHECK(queue_copy.Get_Size() == 9 && queue_copy.Get_Front().value == 1 && Counted::alive == 18);
+        Queue queue_move(std::move(queue_copy));
+        BOOST_CHECK(queue_copy.Is_Empty() && queue_move.Get_Size() == 9 && Counted::alive == 18);
+        queue_copy = queue_move;
+        BOOST_CHECK(queue_copy.Get_Size() == 9 && queue_copy.Get_Front().value == 1 && Counted::alive == 27);
+        queue = std::move(queue_copy);
+        BOOST_CHECK(queue.Get_Size() == 9 && queue_copy.Is_Empty() && Counted::alive == 18);
+        queue_copy.Element_Enqueue(Counted{-1}); // 被移动后仍可使用
+        BOOST_CHECK(queue_copy.Get_Front().value == -1);
+    }
+    BOOST_CHECK(Counted::alive == 0);
+
+    // 拷贝和移动(构造与赋值)都取得源队列的收缩下限
+    auto Shrunk = [](Sequential_Queue_Growable<int> &queue)
+    {
+        for (int i = 0; i < 8; i++)
+            queue.Element_Enqueue(i);
+        while (queue.Get_Size() > 1)
+            queue.Element_Dequeue();
+        queue.Shrink_To_Fit();
+        return queue.Get_Capcity();
+    };
+    Sequential_Queue_Growable<int> small(2), copy_assign(64), move_assign(64);
+    Sequential_Queue_Growable<int> copy_construct(small);
+    copy_assign = small;
+    Sequential_Queue_Growable<int> move_construct(std::move(Sequential_Queue_Growable<int>(small)));
+    move_assign = std::move(small);
+    BOOST_CHECK(Shrunk(copy_construct) == 2 && Shrunk(copy_assign) == 2);
+    BOOST_CHECK(Shrunk(move_construct) == 2 && Shrunk(move_assign) == 2);
+}
@@ -0,0 +1,74 @@
+#define BOOST_TEST_MODULE Sequential_Queue_MPMC
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Sequential/Sequential_Queue_MPMC.hpp"
+#include "Producers_Consumers.hpp"
+#include "../../../../Test/Unit_Test/Counted.hpp"
+
+// g++ Sequential_Queue_MPMC.cpp -g -o Sequential_Queue_MPMC -lboost_unit_test_framework -std=c++20 -pthread
+// valgrind --leak-check=full ./Sequential_Queue_MPMC
+// 检查数据竞争：加上 -fsanitize=thread
+
+BOOST_AUTO_TEST_CASE(Operations)
+{
+    Sequential_Queue_MPMC<int, 4> queue;
+    BOOST_CHECK(queue.Is_Empty() && queue.Get_Capcity() == 4);
+    BOOST_CHECK_THROW(queue.Get_Front(), std::runtime_error);
+    BOOST_CHECK_THROW(queue.Element_Dequeue(), std::runtime_error);
+
+    for (int i = 1; i <= 4; i++)
+        queue.Element_Enqueue(i);
+    BOOST_CHECK(queue.Is_Full() && queue.Get_Size() == 4);
+    BOOST_CHECK_THROW(queue.Element_Enqueue(5), std::runtime_error);
+    BOOST_CHECK(!queue.Try_Enqueue(5));
+
+    int element{};
+    for (int i = 1; i <= 1000; i++) // 槽位序号多轮回绕
+    {
+        BOOST_REQUIRE(queue.Get_Front() == i);
+        BOOST_REQUIRE(queue.Try_Dequeue(element) && element == i);
+        BOOST_REQUIRE(queue.Try_Enqueue(i + 4));
+    }
+    BOOST_CHECK(queue.Get_Size() == 4 && queue.Get_Front() == 1001);
+    queue.Element_Dequeue();
+    BOOST_CHECK(queue.Get_Front() == 1002);
+    queue.Clear();
+    BOOST_CHECK(queue.Is_Empty() && !queue.Try_Dequeue(element));
+    queue.Element_Enqueue(7); // 清空后槽位仍可继续使用
+    BOOST_CHECK(queue.Get_Size() == 1 && queue.Get_Front() == 7);
+}
+
+/// 容量只有4，生产者频繁遇到队满，每个槽位的序号在并发下回绕上万轮；结束后序号仍然一致：恰好能再入队capcity个元素
+BOOST_AUTO_TEST_CASE(Producers_Consumers_Wraparound)
+{
+    Sequential_Queue_MPMC<int, 4> queue;
+    BOOST_CHECK(Producers_Consumers(4, 4, 50000,
+                                    [&](int element) { return queue.Try_Enqueue(element); },
+                                    [&](int &element) { return queue.Try_Dequeue(element); }));
+    BOOST_CHECK(queue.Is_Empty());
+    for (int i = 0; i < 4; i++)
+        BOOST_REQUIRE(queue.Try_Enqueue(i));
+    BOOST_CHECK(queue.Is_Full() && !queue.Try_Enqueue(4) && queue.Get_Front() == 0);
+}
+
+/// 拷贝入队时拷贝构造抛出异常：在抢占槽位之前抛出，槽位的序号不受影响，之后的入队出队正常
+BOOST_AUTO_TEST_CASE(Copy_Throws_Before_Claim)
+{
+    {
+        Sequential_Queue_MPMC<Throw_On_Copy, 2> queue;
+        Throw_On_Copy good{1}, bad{-1};
+        for (int round = 0; round < 4; round++) // 每一轮都经过两个槽位
+        {
+            BOOST_REQUIRE(queue.Try_Enqueue(good));
+            BOOST_REQUIRE_THROW(queue.Try_Enqueue(bad), std::runtime_error);
+            BOOST_REQUIRE_THROW(queue.Element_Enqueue(bad), std::runtime_error);
+            BOOST_REQUIRE(queue.Try_Enqueue(Throw_On_Copy{2}) && queue.Is_Full());
+            Throw_On_Copy element{0};
+            BOOST_REQUIRE(queue.Try_Dequeue(element) && element.value == 1);
+            BOOST_REQUIRE(queue.Try_Dequeue(element) && element.value == 2 && queue.Is_Empty());
+        }
+        BOOST_CHECK(Counted::alive == 2);
+    }
+    BOOST_CHECK(Counted::alive == 0);
+}
@@ -0,0 +1,62 @@
+#define BOOST_TEST_MODULE Sequential_Queue_SPSC
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+
+#include "../../../../Linear_Structure/Linear_Queue/Liner_Queue_Sequential/Sequential_Queue_SPSC.hpp"
+
+// g++ Sequential_Queue_SPSC.cpp -g -o Sequential_Queue_SPSC -lboost_unit_test_framework -std=c++20 -pthread
+// valgrind --leak-check=full ./Sequential_Queue_SPSC
+// 检查数据竞争：加上 -fsanitize=thread
+
+BOOST_AUTO_TEST_CASE(Operations)
+{
+    Sequential_Queue_SPSC<int, 4> queue;
+    BOOST_CHECK(queue.Is_Empty() && queue.Get_Capcity() == 4);
+    BOOST_CHECK_THROW(queue.Get_Front(), std::runtime_error);
+    BOOST_CHECK_THROW(queue.Element_Dequeue(), std::runtime_error);
+
+    for (int i = 1; i <= 4; i++) // 容量为2的幂，不需要多留一个空位
+        queue.Element_Enqueue(i);
+    BOOST_CHECK(queue.Is_Full() && queue.Get_Size() == 4);
+    BOOST_CHECK_THROW(queue.Element_Enqueue(5), std::runtime_error);
+    BOOST_CHECK(!queue.Try_Enqueue(5));
+
+    int element{};
+    for (int i = 1; i <= 1000; i++) // 下标多次回绕
+    {
+        BOOST_REQUIRE(queue.Get_Front() == i);
+        BOOST_REQUIRE(queue.Try_Dequeue(element) && element == i);
+        BOOST_REQUIRE(queue.Try_Enqueue(i + 4));
+    }
+    BOOST_CHECK(queue.Get_Size() == 4 && queue.Get_Front() == 1001);
+    queue.Element_Dequeue();
+    BOOST_CHECK(queue.Get_Front() == 1002);
+    queue.Clear();
+    BOOST_CHECK(queue.Is_Empty() && !queue.Try_Dequeue(element));
+}
+
+/// 两个线程之间传递递增序列，消费者按顺序收到所有元素
+BOOST_AUTO_TEST_CASE(Producer_Consumer)
+{
+    constexpr int count = 200000;
+    Sequential_Queue_SPSC<int, 64> queue;
+    std::thread producer([&]()
+    {
+        for (int i = 0; i < count; i++)
+            while (!queue.Try_Enqueue(i))
+                std::this_thread::yield();
+    });
+
+    bool ordered{true};
+    int element{};
+    for (int expect = 0; expect < count; expect++)
+    {
+        while (!queue.Try_Dequeue(element))
+            std::this_thread::yield();
+        ordered &= element == expect;
+    }
+    producer.join();
+    BOOST_CHECK(ordered && queue.Is_Empty());
+}
@@ -150,3 +150,28 @@ BOOST_AUTO_TEST_CASE(Copy_Control)
         Check_Element<Link_Stack<int>>(stack_move_assign, list_reverse);
     }
 }
+
+#include <string>
+BOOST_AUTO_TEST_CASE(Node_Allocator)
+{
+    using Stack = Link_Stack<std::string, List_Node_SingleWay<std::string>, Policy::Node_Pool<16>>;
+    Stack stack;
+    for (int i = 0; i < 40; i++)
+        stack.Element_Push(std::to_string(i));
+    for (int i = 0; i < 20; i++) // 出栈的节点被之后的入栈复用
+        stack.Element_Pop();
+    for (int i = 0; i < 20; i++)
+        stack.Element_Push("again");
+    BOOST_CHECK(stack.Get_Size() == 40 && stack.Get_Top() == "again");
+
+    Stack stack_copy(stack);
+    BOOST_CHECK(stack_copy.Get_Size() == 40 && stack_copy.Get_Top() == "again");
+    Stack stack_move(std::move(stack));
+    BOOST_CHECK(stack.Is_Empty() && stack_move.Get_Size() == 40);
+    stack_copy = std::move(stack_move);
+    BOOST_CHECK(stack_move.Is_Empty() && stack_copy.Get_Size() == 40);
+    stack_copy.Clear(); // 整体释放
+    BOOST_CHECK(stack_copy.Is_Empty());
+    stack_copy.Element_Push("reuse");
+    BOOST_CHECK(stack_copy.Get_Top() == "reuse");
+}
@@ -0,0 +1,119 @@
+#define BOOST_TEST_MODULE Link_Stack_Concurrent
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../../../../Linear_Structure/Linear_Stack/Linear_Stack_Linked/Link_Stack_Concurrent.hpp"
+#include "../../../../Test/Unit_Test/Counted.hpp"
+
+// g++ Link_Stack_Concurrent.cpp -g -o Link_Stack_Concurrent -lboost_unit_test_framework -std=c++20 -pthread
+// valgrind --leak-check=full ./Link_Stack_Concurrent
+// 检查数据竞争：加上 -fsanitize=thread
+
+BOOST_AUTO_TEST_CASE(Operations)
+{
+    Link_Stack_Concurrent<int> stack;
+    BOOST_CHECK(stack.Is_Empty() && stack.Get_Size() == 0);
+    BOOST_CHECK_THROW(stack.Get_Top(), std::runtime_error);
+    BOOST_CHECK_THROW(stack.Element_Pop(), std::runtime_error);
+
+    for (int i = 1; i <= 1000; i++)
+        stack.Element_Push(i);
+    BOOST_CHECK(stack.Get_Size() == 1000 && stack.Get_Top() == 1000);
+
+    int element{};
+    for (int i = 1000; i > 500; i--)
+        BOOST_REQUIRE(stack.Try_Pop(element) && element == i);
+    for (int i = 0; i < 500; i++) // 出栈的节点经回收后被复用
+        stack.Element_Push(-i);
+    BOOST_CHECK(stack.Get_Size() == 1000 && stack.Get_Top() == -499);
+    stack.Element_Pop();
+    BOOST_CHECK(stack.Get_Top() == -498);
+    stack.Clear();
+    BOOST_CHECK(stack.Is_Empty() && !stack.Try_Pop(element));
+    stack.Element_Push(7);
+    BOOST_CHECK(stack.Get_Size() == 1 && stack.Get_Top() == 7);
+}
+
+/// 出栈的节点交给回收域，纪元推进后才回收：存活的节点数不随出栈次数增长，栈析构后剩余的也会被释放
+BOOST_AUTO_TEST_CASE(Retire_Reclamation)
+{
+    {
+        Link_Stack_Concurrent<Counted_Default> stack; // 出栈时重置元素，需要默认构造
+        for (int i = 0; i < 10000; i++)
+        {
+            stack.Element_Push(Counted_Default{i});
+            stack.Element_Pop();
+        }
+        for (int i = 0; i < 3; i++)
+            stack.Element_Push(Counted_Default{i});
+        // 回收域每回收64个对象推进一次纪元，只有最近几个纪元出栈的节点还未回收
+        BOOST_CHECK(Counted::alive < 3 + 4 * 64);
+
+        Link_Stack_Concurrent<Counted_Default> copy(stack);
+        Counted_Default element;
+        BOOST_CHECK(copy.Try_Pop(element) && element.value == 2 && copy.Get_Size() == 2);
+    }
+    // 已出栈的节点仍在回收袋中，之后的回收推进纪元时释放
+    Link_Stack_Concurrent<int> stack;
+    for (int i = 0; i < 1000; i++)
+    {
+        stack.Element_Push(i);
+        stack.Element_Pop();
+    }
+    BOOST_CHECK(Counted::alive == 0);
+}
+
+/// 节点延迟回收，但出栈的元素立即释放资源：Element_Pop/Clear重置元素，Try_Pop移出元素
+BOOST_AUTO_TEST_CASE(Element_Release)
+{
+    auto resource = std::make_shared<int>(1);
+    Link_Stack_Concurrent<std::shared_ptr<int>> stack;
+    stack.Element_Push(resource);
+    stack.Element_Pop();
+    BOOST_CHECK(resource.use_count() == 1);
+
+    stack.Element_Push(resource);
+    stack.Element_Push(resource);
+    std::shared_ptr<int> element;
+    BOOST_CHECK(stack.Try_Pop(element) && resource.use_count() == 3);
+    element.reset();
+    stack.Clear();
+    BOOST_CHECK(resource.use_count() == 1);
+}
+
+/// 每个线程交替入栈和出栈，节点被频繁回收复用(容易出现ABA的情形)：每个元素恰好被取出一次
+BOOST_AUTO_TEST_CASE(Push_Pop_Threads)
+{
+    constexpr int thread_count = 4, count = 50000;
+    Link_Stack_Concurrent<int> stack;
+    std::vector<std::atomic<int>> received(thread_count * count);
+
+    auto Receive = [&](int element) { received[element].fetch_add(1); };
+    std::vector<std::thread> threads;
+    for (int id = 0; id < thread_count; id++)
+        threads.emplace_back([&, id]()
+        {
+            int element{};
+            for (int i = 0; i < count; i++)
+            {
+                stack.Element_Push(id * count + i);
+                if (i % 3 != 2 && stack.Try_Pop(element)) // 出栈约为入栈的2/3，栈的长度缓慢增长
+                    Receive(element);
+            }
+        });
+    for (auto &thread : threads)
+        thread.join();
+
+    int element{};
+    while (stack.Try_Pop(element))
+        Receive(element);
+    bool exactly_once{true};
+    for (auto &times : received)
+        exactly_once &= times.load() == 1;
+    BOOST_CHECK(exactly_once && stack.Is_Empty());
+}
@@ -11,6 +11,7 @@
 #include "../../../../Linear_Structure/Linear_Stack/Linear_Stack_Sequential/Sequential_Stack.hpp"
 
 #include "../../../../Test/Unit_Test/Test_Element.hpp"
+#include "../../../../Test/Unit_Test/Counted.hpp"
 
 // g++ Sequential_Stack.cpp -g -o Sequential_Stack -lboost_unit_test_framework -std=c++20
 // valgrind --leak-check=full ./Sequential_Stack
@@ -160,3 +161,40 @@ BOOST_AUTO_TEST_CASE(Copy_Control)
     _Copy_Control<Sequential_Stack_Full_Ascending<int, 5>>();
     _Copy_Control<Sequential_Stack_Full_Descending<int, 5>>();
 }
+
+/// 空闲位置没有构造元素，每个元素恰好析构一次
+template <typename StackType>
+void _Uninitialized_Storage()
+{
+    {
+        StackType stack;
+        BOOST_CHECK(Counted::alive == 0);
+        for (int i = 1; i <= 3; i++)
+            stack.Element_Push(Counted{i});
+        BOOST_CHECK(Counted::alive == 3);
+        stack.Element_Pop();
+        BOOST_CHECK(Counted::alive == 2 && stack.Get_Top().value == 2);
+
+        StackType stack_copy(stack);
+        BOOST_CHECK(Counted::alive == 4 && stack_copy.Get_Top().value == 2);
+        StackType stack_move(std::move(stack));
+        BOOST_CHECK(Counted::alive == 4 && stack.Is_Empty() && stack_move.Get_Top().value == 2);
+        stack_move.Element_Pop();
+        BOOST_CHECK(stack_move.Get_Top().value == 1);
+
+        stack_copy = stack_move;
+        BOOST_CHECK(Counted::alive == 2 && stack_copy.Get_Size() == 1);
+        stack_copy.Clear();
+        BOOST_CHECK(Counted::alive == 1);
+        stack_copy.Element_Push(Counted{9});
+        BOOST_CHECK(stack_copy.Get_Top().value == 9);
+    }
+    BOOST_CHECK(Counted::alive == 0);
+}
+BOOST_AUTO_TEST_CASE(Uninitialized_Storage)
+{
+    _Uninitialized_Storage<Sequential_Stack_Empty_Ascending  <Counted,5>>();
+    _Uninitialized_Storage<Sequential_Stack_Empty_Descending <Counted,5>>();
+    _Uninitialized_Storage<Sequential_Stack_Full_Ascending   <Counted,5>>();
+    _Uninitialized_Storage<Sequential_Stack_Full_Descending  <Counted,5>>();
+}
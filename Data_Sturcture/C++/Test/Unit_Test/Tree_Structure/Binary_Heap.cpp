@@ -11,6 +11,7 @@
 #include "../../../Tree_Structure/Heap/Binary_Heap.hpp"
 
 #include "../Test_Element.hpp"
+#include "../Counted.hpp"
 
 // g++ unit_test.cpp -g -o unit_test -lboost_unit_test_framework -std=c++20
 
@@ -156,3 +157,25 @@ BOOST_AUTO_TEST_CASE(Copy_Control)
     test(heap_move, 0);
     BOOST_CHECK((heap_move_assign == heap_copy));
 }
+
+/// 空闲位置没有构造元素，每个元素恰好析构一次
+BOOST_AUTO_TEST_CASE(Uninitialized_Storage)
+{
+    {
+        Binary_Heap<Counted, 8> heap;
+        BOOST_CHECK(Counted::alive == 0);
+        for (int i : {5, 3, 7, 1})
+            heap.Push(Counted{i});
+        BOOST_CHECK(Counted::alive == 4 && heap.Get_Top().value == 1);
+        heap.Pop();
+        BOOST_CHECK(Counted::alive == 3 && heap.Get_Top().value == 3);
+
+        Binary_Heap<Counted, 8> heap_copy(heap);
+        BOOST_CHECK(Counted::alive == 6 && heap_copy == heap);
+        Binary_Heap<Counted, 8> heap_move(std::move(heap));
+        BOOST_CHECK(Counted::alive == 6 && heap.Is_Empty());
+        heap_copy.Clear();
+        BOOST_CHECK(Counted::alive == 3);
+    }
+    BOOST_CHECK(Counted::alive == 0);
+}
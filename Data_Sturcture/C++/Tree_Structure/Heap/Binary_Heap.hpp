@@ -1,6 +1,9 @@
 #pragma once
 
 #include <iostream>
+#include <memory> //construct_at
+
+#include "../../Uninitialized_Array.hpp"
 
 #define Debug // IF Run Unit Test, Enable this
 
@@ -28,7 +31,7 @@ public:
 		Left,
 		Right
 	};
-	ElementType storage[maxsize]{}; // 存放排序关键值的数组
+	Uninitialized_Array<ElementType, maxsize> storage; // 存放排序关键值的数组，只有[0,size)构造了元素
 	size_t size{};
 
 public:
@@ -40,40 +43,33 @@ public:
 	Binary_Heap(const Binary_Heap<ElementType, maxsize, CompareMethod> &other)
 		: size(other.size)
 	{
-		for (size_t i = 0; i < size; i++)
-			storage[i] = other.storage[i];
+		std::uninitialized_copy_n(other.storage.Data(), size, storage.Data());
 	}
 	Binary_Heap<ElementType, maxsize, CompareMethod> &
 	operator=(const Binary_Heap<ElementType, maxsize, CompareMethod> &other)
 	{
 		if (this == &other)
 			throw std::logic_error("Slef Copied");
+		Clear();
+		std::uninitialized_copy_n(other.storage.Data(), other.size, storage.Data());
 		size = other.size;
-		for (size_t i = 0; i < size; i++)
-			storage[i] = other.storage[i];
 		return *this;
 	}
 	Binary_Heap(Binary_Heap<ElementType, maxsize, CompareMethod> &&other)
 		: size(other.size)
 	{
-		for (size_t i = 0; i < size; i++)
-		{
-			storage[i] = std::move(other.storage[i]);
-			other.storage[i] = ElementType{};
-		}
-		other.size = 0;
+		std::uninitialized_move_n(other.storage.Data(), size, storage.Data());
+		other.Clear();
 	}
 	Binary_Heap<ElementType, maxsize, CompareMethod> &
 	operator=(Binary_Heap<ElementType, maxsize, CompareMethod> &&other)
 	{
 		if (this == &other)
 			throw std::logic_error("Slef Copied");
+		Clear();
+		std::uninitialized_move_n(other.storage.Data(), other.size, storage.Data());
 		size = other.size;
-		for (size_t i = 0; i < size; i++)
-		{
-			storage[i] = std::move(other.storage[i]);
-			other.storage[i] = ElementType{};
-		}
+		other.Clear();
 		return *this;
 	}
 
@@ -89,6 +85,10 @@ public:
 		// 以上是最简单的实现方式，也可以直接进行堆排序，然后再赋值给数组,暂不演示
 		/// ============================================================================================================
 	}
+	~Binary_Heap()
+	{
+		Clear();
+	}
 
 private:
 	// 下标->位序
@@ -162,11 +162,11 @@ private:
 	}
 
 public:
-	// 清空所有元素
+	// 清空所有元素，只析构现有的元素
 	void Clear()
 	{
-		while (!Is_Empty())
-			Pop();
+		std::destroy_n(storage.Data(), size);
+		size = 0;
 	}
 	void Heap_Show()
 	{
@@ -174,8 +174,10 @@ public:
 			<< "Length:" << size << std::endl
 			<< "index end:" << size << std::endl
 			<< "Maxsize:" << maxsize << std::endl;
-		for (size_t i = 0; i < maxsize; i++)
+		for (size_t i = 0; i < size; i++)
 			std::cout << "[" << i << ':' << storage[i] << "] ";
+		for (size_t i = size; i < maxsize; i++) // 空闲位置没有构造元素，不访问
+			std::cout << "[" << i << ":] ";
 		std::cout << std::endl;
 	}
 	constexpr size_t Get_Size() const { return size; }
@@ -200,16 +202,16 @@ public:
 	{
 		if (size >= maxsize)
 			throw std::runtime_error("Insert Failed: Heap is full");
+		std::construct_at(storage.Data() + size, element);
 		size++;
-		this->storage[_Index(size)] = element;
 		_Element_Upflow(_Index(size));
 	}
 	void Push(ElementType &&element)
 	{
 		if (size >= maxsize)
 			throw std::runtime_error("Insert Failed: Heap is full");
+		std::construct_at(storage.Data() + size, std::move(element));
 		size++;
-		this->storage[_Index(size)] = std::move(element);
 		_Element_Upflow(_Index(size));
 	}
 
@@ -220,7 +222,7 @@ public:
 			throw std::runtime_error("Extract Failed: Heap is empty");
 		if (size != 1)									  // 一个元素时堆顶==末尾元素，会造成自我拷贝，所以直接跳过交换
 			Get_Top() = std::move(storage[_Index(size)]); // 尾元素覆盖堆顶
-		storage[_Index(size)] = ElementType{};			  // 重置尾元素
+		std::destroy_at(storage.Data() + _Index(size));	  // 析构尾元素
 
 		--size; // 先下沉，再减少size
 		if (size != 0)
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+
+/// @brief 未初始化的定长数组，只提供按ElementType对齐的原始内存
+/// @tparam count 元素个数
+/// @note 用于替代ElementType array[count]{}：不会预先默认构造所有元素，元素类型也不需要默认构造。
+/// 	哪些位置上构造了元素由使用它的容器负责记录，容器需要用std::construct_at构造、std::destroy_at析构元素
+template <typename ElementType, size_t count>
+struct Uninitialized_Array
+{
+	static_assert(count > 0, "Uninitialized_Array must hold at least 1 element");
+
+	alignas(ElementType) std::byte buffer[sizeof(ElementType) * count];
+
+	ElementType *Data() { return reinterpret_cast<ElementType *>(buffer); }
+	const ElementType *Data() const { return reinterpret_cast<const ElementType *>(buffer); }
+
+	/// @note 仅访问已经构造了元素的位置
+	ElementType &operator[](size_t index) { return Data()[index]; }
+	const ElementType &operator[](size_t index) const { return Data()[index]; }
+};
@@ -22,7 +22,13 @@ namespace Adapter
 		std::vector<Node *> Get_Storage(){return this->header;}
 		Node * Get_Tail(){return this->tail;}
 		int Get_Current_Level(){return this->level;}
-		std::map<size_t, Node *> Get_Search_Path(){return this->search_path;}
+		// 搜索element时每层的前驱，nullptr表示头结点
+		Search_Path Get_Search_Path(int element)
+		{
+			Search_Path search_path{};
+			this->_Locate_Previous_Node(element, search_path);
+			return search_path;
+		}
 
 		template<typename NodeType>
 		using Serialized_Container=std::vector<std::vector<NodeType*>>;